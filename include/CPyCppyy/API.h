@@ -213,6 +213,10 @@ CPYCPPYY_EXTERN bool Sequence_Check(PyObject* pyobject);
 // helper to verify expected safety of moving an instance into C++
 CPYCPPYY_EXTERN bool Instance_IsLively(PyObject* pyobject);
 
+// identity tracking (re-use of the proxy of a known C++ address) for the objects of a
+// class, or of all classes in a namespace; on by default
+CPYCPPYY_EXTERN void Scope_SetIdentityTracking(Cppyy::TCppScope_t scope, bool track);
+
 // type verifiers for C++ Overload
 CPYCPPYY_EXTERN bool Overload_Check(PyObject* pyobject);
 CPYCPPYY_EXTERN bool Overload_CheckExact(PyObject* pyobject);
@@ -8,6 +8,7 @@
 #include "CPPInstance.h"
 #include "CPPOverload.h"
 #include "CPPScope.h"
+#include "MemoryRegulator.h"
 #include "CPyCppyy/DispatchPtr.h"
 #include "ProxyWrappers.h"
 #include "PyStrings.h"
@@ -280,6 +281,17 @@ bool CPyCppyy::Instance_IsLively(PyObject* pyobject)
     return true;
 }
 
+//-----------------------------------------------------------------------------
+void CPyCppyy::Scope_SetIdentityTracking(Cppyy::TCppScope_t scope, bool track)
+{
+// Set the identity tracking policy for the given class or namespace.
+    if (!Initialize())
+        return;
+
+    PythonGILRAII python_gil_raii;
+    MemoryRegulator::SetTrackingPolicy(scope, track);
+}
+
 //-----------------------------------------------------------------------------
 bool CPyCppyy::Overload_Check(PyObject* pyobject)
 {
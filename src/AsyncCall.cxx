@@ -0,0 +1,218 @@
+// Bindings
+#include "CPyCppyy.h"
+#include "AsyncCall.h"
+#include "CPPInstance.h"
+
+// Standard
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+
+//- worker threads -----------------------------------------------------------
+namespace CPyCppyy {
+
+class AsyncWorkers {
+public:
+    static void Push(AsyncCall* call) {
+        static AsyncWorkers* workers = new AsyncWorkers{};   // leaked: threads are detached
+        workers->PushImpl(call);
+    }
+
+private:
+    void PushImpl(AsyncCall* call) {
+        {
+            std::lock_guard<std::mutex> lock(fMutex);
+            fQueue.push_back(call);
+        // start another thread if all are busy
+            if (fIdle < fQueue.size() && fNThreads < CPYCPPYY_ASYNC_THREADS) {
+                fNThreads += 1;
+                std::thread(&AsyncWorkers::Work, this).detach();
+            }
+        }
+        fCondition.notify_one();
+    }
+
+    void Work() {
+        while (true) {
+            AsyncCall* call = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(fMutex);
+                fIdle += 1;
+                fCondition.wait(lock, [this] { return !fQueue.empty(); });
+                fIdle -= 1;
+                call = fQueue.front();
+                fQueue.pop_front();
+            }
+            call->Run();
+        }
+    }
+
+private:
+    std::mutex fMutex;
+    std::condition_variable fCondition;
+    std::deque<AsyncCall*> fQueue;
+    size_t fIdle = 0;
+    int fNThreads = 0;
+};
+
+} // namespace CPyCppyy
+
+
+//- local helpers ------------------------------------------------------------
+namespace {
+
+// completion of the future, scheduled on the event loop thread; a cancelled future
+// simply drops the result
+PyObject* AsyncComplete(PyObject*, PyObject* args)
+{
+    PyObject *future = nullptr, *value = nullptr, *is_error = nullptr;
+    if (!PyArg_ParseTuple(args, const_cast<char*>("OOO"), &future, &value, &is_error))
+        return nullptr;
+
+    PyObject* cancelled = PyObject_CallMethod(future, (char*)"cancelled", nullptr);
+    if (!cancelled)
+        return nullptr;
+    int isc = PyObject_IsTrue(cancelled);
+    Py_DECREF(cancelled);
+    if (isc)
+        Py_RETURN_NONE;
+
+    return PyObject_CallMethod(future,
+        (char*)(is_error == Py_True ? "set_exception" : "set_result"), (char*)"O", value);
+}
+
+PyMethodDef gAsyncCompleteDef = {
+    (char*)"_async_complete", (PyCFunction)AsyncComplete, METH_VARARGS, nullptr};
+
+PyObject* FetchException()
+{
+// current error as an exception object, with traceback
+#if PY_VERSION_HEX >= 0x030c0000
+    PyObject* value = PyErr_GetRaisedException();
+#else
+    PyObject *type = nullptr, *value = nullptr, *trace = nullptr;
+    PyErr_Fetch(&type, &value, &trace);
+    PyErr_NormalizeException(&type, &value, &trace);
+    if (value && trace)
+        PyException_SetTraceback(value, trace);
+    Py_XDECREF(trace);
+    Py_XDECREF(type);
+#endif
+    if (!value) {
+        PyErr_SetString(PyExc_SystemError, "nullptr result without error in asynchronous call");
+        return FetchException();
+    }
+    return value;
+}
+
+} // unnamed namespace
+
+
+//- AsyncCall ----------------------------------------------------------------
+CPyCppyy::AsyncCall* CPyCppyy::AsyncCall::Create()
+{
+    static PyObject* asyncio = nullptr;
+    if (!asyncio) {
+        asyncio = PyImport_ImportModule("asyncio");
+        if (!asyncio)
+            return nullptr;
+    }
+
+    PyObject* loop = PyObject_CallMethod(asyncio, (char*)"get_running_loop", nullptr);
+    if (!loop)
+        return nullptr;
+
+    PyObject* future = PyObject_CallMethod(loop, (char*)"create_future", nullptr);
+    PyObject* call_soon = future ? PyObject_GetAttrString(loop, "call_soon_threadsafe") : nullptr;
+    Py_DECREF(loop);
+    if (!call_soon) {
+        Py_XDECREF(future);
+        return nullptr;
+    }
+
+    AsyncCall* call = new AsyncCall{};
+    call->fCallSoon = call_soon;
+    call->fFuture   = future;
+    call->fCtxt.fFlags |= CallContext::kAsyncCall;
+    call->fCtxt.fAsync  = call;
+    return call;
+}
+
+//----------------------------------------------------------------------------
+CPyCppyy::AsyncCall::~AsyncCall()
+{
+// requires the GIL, also for the cleanup of the temporaries in fCtxt
+    Py_XDECREF((PyObject*)fSelf);
+    for (auto pyobj : fKeepAlive)
+        Py_DECREF(pyobj);
+    Py_XDECREF(fFuture);
+    Py_XDECREF(fCallSoon);
+}
+
+//----------------------------------------------------------------------------
+PyObject* CPyCppyy::AsyncCall::Submit(PyObject* result)
+{
+    PyObject* future = fFuture;
+    Py_INCREF(future);
+
+    if (!fExecute) {
+    // nothing left to run (e.g. a Python overload was selected)
+        PyObject* args = PyTuple_Pack(3, future, result, Py_False);
+        PyObject* done = AsyncComplete(nullptr, args);
+        Py_DECREF(args);
+        Py_DECREF(result);
+        delete this;
+        if (!done) {
+            Py_DECREF(future);
+            return nullptr;
+        }
+        Py_DECREF(done);
+        return future;
+    }
+
+// result is only a placeholder from the capture
+    Py_DECREF(result);
+    AsyncWorkers::Push(this);
+    return future;
+}
+
+//----------------------------------------------------------------------------
+void CPyCppyy::AsyncCall::Run()
+{
+// run on a worker thread
+    PyGILState_STATE state = PyGILState_Ensure();
+
+    fCtxt.fFlags &= ~CallContext::kAsyncCall;
+    fCtxt.fAsync = nullptr;
+
+    PyObject* result = fExecute(&fCtxt);
+    if (result && fFinish)
+        result = fFinish(this, result);
+
+    if (result) {
+        Complete(result, false);
+        Py_DECREF(result);
+    } else {
+        PyObject* exc = FetchException();
+        Complete(exc, true);
+        Py_DECREF(exc);
+    }
+
+    delete this;
+    PyGILState_Release(state);
+}
+
+//----------------------------------------------------------------------------
+void CPyCppyy::AsyncCall::Complete(PyObject* value, bool is_error)
+{
+// schedule completion of the future on the event loop thread
+    static PyObject* complete = PyCFunction_New(&gAsyncCompleteDef, nullptr);
+
+    PyObject* done = PyObject_CallFunctionObjArgs(
+        fCallSoon, complete, fFuture, value, is_error ? Py_True : Py_False, nullptr);
+    if (!done)        // e.g. because the event loop was closed
+        PyErr_WriteUnraisable(fFuture);
+    Py_XDECREF(done);
+}
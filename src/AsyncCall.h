@@ -0,0 +1,77 @@
+#ifndef CPYCPPYY_ASYNCCALL_H
+#define CPYCPPYY_ASYNCCALL_H
+
+// Bindings
+#include "CallContext.h"
+
+// Standard
+#include <functional>
+#include <vector>
+
+
+namespace CPyCppyy {
+
+class CPPInstance;
+
+// maximum number of worker threads for asynchronous calls (started on demand)
+#ifndef CPYCPPYY_ASYNC_THREADS
+#define CPYCPPYY_ASYNC_THREADS 4
+#endif
+
+/** A C++ call with converted arguments, to be run on a worker thread
+ */
+
+class AsyncCall {
+public:
+// create a call bound to the running asyncio event loop; returns nullptr, with an
+// error set, if there is none
+    static AsyncCall* Create();
+
+    AsyncCall(const AsyncCall&) = delete;
+    AsyncCall& operator=(const AsyncCall&) = delete;
+    ~AsyncCall();
+
+public:
+// keep an object alive for the duration of the call (steals a reference)
+    void KeepAlive(PyObject* pyobj) { if (pyobj) fKeepAlive.push_back(pyobj); }
+
+// hand the call to the worker threads, or, if there is no captured C++ call, complete
+// with result immediately; returns a new reference to the future and deletes the call
+// once completed
+    PyObject* Submit(PyObject* result);
+
+public:
+// call state; the context holds the converted arguments and their temporaries
+    CallContext fCtxt;
+
+// C++ call captured on dispatch (see CPPMethod::Execute()); run with the GIL held,
+// but released for the duration of the C++ call itself if it does not touch Python
+    std::function<PyObject*(CallContext*)> fExecute;
+
+// optional post-processing of the result of fExecute, with the GIL held
+    PyObject* (*fFinish)(AsyncCall*, PyObject* result);
+
+// bound self of the selected overload, if any (owned)
+    CPPInstance* fSelf;
+
+// owner of the call, for use by fFinish (borrowed, add to fKeepAlive as needed)
+    PyObject* fOwner;
+
+private:
+    AsyncCall() : fFinish(nullptr), fSelf(nullptr), fOwner(nullptr),
+        fCallSoon(nullptr), fFuture(nullptr) {}
+
+    void Run();
+    void Complete(PyObject* value, bool is_error);
+
+    friend class AsyncWorkers;
+
+private:
+    PyObject* fCallSoon;          // loop.call_soon_threadsafe
+    PyObject* fFuture;
+    std::vector<PyObject*> fKeepAlive;
+};
+
+} // namespace CPyCppyy
+
+#endif // !CPYCPPYY_ASYNCCALL_H
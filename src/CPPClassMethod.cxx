@@ -5,6 +5,18 @@
 
 
 //- public members --------------------------------------------------------------
+int CPyCppyy::CPPClassMethod::ArgMatch(CPPInstance* /* self */,
+    CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds, CallContext* ctxt)
+{
+// a first argument of class type may be dropped by Call(), so leave that to it
+    if (kwds || (CPyCppyy_PyArgs_GET_SIZE(args, nargsf) && \
+            CPPInstance_Check(CPyCppyy_PyArgs_GET_ITEM(args, 0))))
+        return kMaybeMatch;
+
+    return this->MatchArgs_(args, nargsf, ctxt);
+}
+
+//----------------------------------------------------------------------------
 PyObject *CPyCppyy::CPPClassMethod::Call(CPPInstance *&self, CPyCppyy_PyArgs_t args,
                                          size_t nargsf, PyObject *kwds, CallContext *ctxt)
 {
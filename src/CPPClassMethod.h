@@ -16,6 +16,8 @@ public:
 
 public:
     PyCallable* Clone() override { return new CPPClassMethod(*this); }
+    int ArgMatch(CPPInstance* self,
+        CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds, CallContext* ctxt) override;
     PyObject* Call(CPPInstance*& self,
         CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds, CallContext* ctxt = nullptr) override;
 };
@@ -54,12 +54,26 @@ PyObject* CPyCppyy::CPPConstructor::Reflex(
     return PyCallable::Reflex(request, format);
 }
 
+//----------------------------------------------------------------------------
+int CPyCppyy::CPPConstructor::ArgMatch(CPPInstance* self,
+    CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds, CallContext* ctxt)
+{
+// only direct construction is checked: dispatchers, errors on self, and implicit
+// conversion calls (which modify the call context) are left to Call()
+    if (!self || kwds || self->GetObject() || \
+            (((CPPScope*)Py_TYPE(self))->fFlags & CPPScope::kActiveImplicitCall) || \
+            GetScope() != self->ObjectIsA(false /* check_smart */))
+        return kMaybeMatch;
+
+    return this->MatchArgs_(args, nargsf, ctxt);
+}
+
 //----------------------------------------------------------------------------
 PyObject* CPyCppyy::CPPConstructor::Call(CPPInstance*& self,
     CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds, CallContext* ctxt)
 {
 // setup as necessary
-    if (fArgsRequired == -1 && !this->Initialize(ctxt))
+    if (!this->IsInitialized_() && !this->Initialize(ctxt))
         return nullptr;                     // important: 0, not Py_None
 
 // fetch self, verify, and put the arguments in usable order
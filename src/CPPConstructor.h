@@ -17,6 +17,8 @@ public:
                              Cppyy::Reflex::FormatId_t = Cppyy::Reflex::OPTIMAL) override;
 
     PyCallable* Clone() override { return new CPPConstructor(*this); }
+    int ArgMatch(CPPInstance* self,
+        CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds, CallContext* ctxt) override;
     PyObject* Call(CPPInstance*& self,
         CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds, CallContext* ctxt = nullptr) override;
 
@@ -34,6 +36,9 @@ public:
 
 public:
     PyCallable* Clone() override { return new CPPMultiConstructor(*this); }
+    int ArgMatch(CPPInstance*, CPyCppyy_PyArgs_t, size_t, PyObject*, CallContext*) override {
+        return kMaybeMatch;
+    }
     PyObject* Call(CPPInstance*& self,
         CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds, CallContext* ctxt = nullptr) override;
 
@@ -49,6 +54,9 @@ public:
 
 public:
     PyCallable* Clone() override { return new CPPAbstractClassConstructor(*this); }
+    int ArgMatch(CPPInstance*, CPyCppyy_PyArgs_t, size_t, PyObject*, CallContext*) override {
+        return kMaybeMatch;
+    }
     PyObject* Call(CPPInstance*& self,
         CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds, CallContext* ctxt = nullptr) override;
 };
@@ -59,6 +67,9 @@ public:
 
 public:
     PyCallable* Clone() override { return new CPPNamespaceConstructor(*this); }
+    int ArgMatch(CPPInstance*, CPyCppyy_PyArgs_t, size_t, PyObject*, CallContext*) override {
+        return kMaybeMatch;
+    }
     PyObject* Call(CPPInstance*& self,
         CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds, CallContext* ctxt = nullptr) override;
 };
@@ -69,6 +80,9 @@ public:
 
 public:
     PyCallable* Clone() override { return new CPPIncompleteClassConstructor(*this); }
+    int ArgMatch(CPPInstance*, CPyCppyy_PyArgs_t, size_t, PyObject*, CallContext*) override {
+        return kMaybeMatch;
+    }
     PyObject* Call(CPPInstance*& self,
         CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds, CallContext* ctxt = nullptr) override;
 };
@@ -79,6 +93,9 @@ public:
 
 public:
     PyCallable* Clone() override { return new CPPAllPrivateClassConstructor(*this); }
+    int ArgMatch(CPPInstance*, CPyCppyy_PyArgs_t, size_t, PyObject*, CallContext*) override {
+        return kMaybeMatch;
+    }
     PyObject* Call(CPPInstance*& self,
         CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds, CallContext* ctxt = nullptr) override;
 };
@@ -42,11 +42,22 @@ bool CPyCppyy::CPPFunction::ProcessArgs(PyCallArgs& cargs)
 }
 
 //- CPPFunction public members --------------------------------------------------
+int CPyCppyy::CPPFunction::ArgMatch(CPPInstance* self,
+    CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds, CallContext* ctxt)
+{
+// a rebound self or keywords require reordering of the arguments first
+    if (self || kwds)
+        return kMaybeMatch;
+
+    return this->MatchArgs_(args, nargsf, ctxt);
+}
+
+//----------------------------------------------------------------------------
 PyObject* CPyCppyy::CPPFunction::Call(CPPInstance*& self,
     CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds, CallContext* ctxt)
 {
 // setup as necessary
-    if (fArgsRequired == -1 && !this->Initialize(ctxt))
+    if (!this->IsInitialized_() && !this->Initialize(ctxt))
         return nullptr;
 
 // if function was attached to a class, self will be non-zero and should be
@@ -115,7 +126,7 @@ PyObject* CPyCppyy::CPPReverseBinary::Call(CPPInstance*& self,
 // that ProcessArgs() is always called.
 
 // setup as necessary
-    if (fArgsRequired == -1 && !this->Initialize(ctxt))
+    if (!this->IsInitialized_() && !this->Initialize(ctxt))
         return nullptr;
 
 // if function was attached to a class, self will be non-zero and should be
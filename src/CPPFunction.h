@@ -17,6 +17,8 @@ public:
 
 public:
     PyCallable* Clone() override { return new CPPFunction(*this); }
+    int ArgMatch(CPPInstance* self,
+        CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds, CallContext* ctxt) override;
     PyObject* Call(CPPInstance*& self,
         CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds, CallContext* ctxt = nullptr) override;
 
@@ -30,6 +32,9 @@ public:
     using CPPFunction::CPPFunction;
 
     PyCallable* Clone() override { return new CPPFunction(*this); }
+    int ArgMatch(CPPInstance*, CPyCppyy_PyArgs_t, size_t, PyObject*, CallContext*) override {
+        return kMaybeMatch;
+    }
     PyObject* Call(CPPInstance*& self,
         CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds, CallContext* ctxt = nullptr) override;
 
@@ -13,6 +13,9 @@ public:
 
 public:
     PyCallable* Clone() override { return new CPPSetItem(*this); }
+    int ArgMatch(CPPInstance*, CPyCppyy_PyArgs_t, size_t, PyObject*, CallContext*) override {
+        return kMaybeMatch;     // arguments are unrolled by ProcessArgs()
+    }
 
 protected:
     bool ProcessArgs(PyCallArgs& args) override;
@@ -25,6 +28,9 @@ public:
 
 public:
     PyCallable* Clone() override { return new CPPGetItem(*this); }
+    int ArgMatch(CPPInstance*, CPyCppyy_PyArgs_t, size_t, PyObject*, CallContext*) override {
+        return kMaybeMatch;     // arguments are unrolled by ProcessArgs()
+    }
 
 protected:
     bool ProcessArgs(PyCallArgs& args) override;
@@ -4,6 +4,7 @@
 #include "CPPScope.h"
 #include "CPPOverload.h"
 #include "Cppyy.h"
+#include "DestructionQueue.h"
 #include "MemoryRegulator.h"
 #include "ProxyWrappers.h"
 #include "PyStrings.h"
@@ -15,6 +16,7 @@
 // Standard
 #include <algorithm>
 #include <sstream>
+#include <string.h>
 
 
 //- data _____________________________________________________________________
@@ -444,10 +446,42 @@ static PyMethodDef op_methods[] = {
 
 
 //= CPyCppyy object proxy construction/destruction ===========================
+// Proxies are recycled through a bounded free list per class where that is safe (see
+// CPPScope::kRecycleProxies), chained through fObject; this saves allocator churn for
+// objects that are bound and released at high rates, e.g. when iterating containers.
+#ifndef CPYCPPYY_INSTANCE_MAXFREELIST
+#define CPYCPPYY_INSTANCE_MAXFREELIST 16
+#endif
+static uint32_t gInstanceFreeListLimit = CPYCPPYY_INSTANCE_MAXFREELIST;
+static size_t   gInstancesAllocated = 0;
+static size_t   gInstancesReused    = 0;
+
+// recycling is only safe for types allocated through the generic allocator (see CPPScope)
+static inline bool CanRecycle(PyTypeObject* pytype) {
+    return (pytype->tp_flags & Py_TPFLAGS_HEAPTYPE) &&
+        (((CPPScope*)pytype)->fFlags & CPPScope::kRecycleProxies);
+}
+
 static CPPInstance* op_new(PyTypeObject* subtype, PyObject*, PyObject*)
 {
 // Create a new object proxy (holder only).
-    CPPInstance* pyobj = (CPPInstance*)subtype->tp_alloc(subtype, 0);
+    CPPInstance* pyobj = nullptr;
+    if (CanRecycle(subtype) && ((CPPScope*)subtype)->fFreeList) {
+        CPPScope* klass = (CPPScope*)subtype;
+        pyobj = (CPPInstance*)klass->fFreeList;
+        klass->fFreeList = (PyObject*)pyobj->fObject;
+        klass->fNFree -= 1;
+        memset((char*)pyobj + sizeof(PyObject), 0, subtype->tp_basicsize - sizeof(PyObject));
+        (void)PyObject_INIT(pyobj, subtype);
+        PyObject_GC_Track(pyobj);
+        gInstancesReused += 1;
+    } else {
+        pyobj = (CPPInstance*)subtype->tp_alloc(subtype, 0);
+        if (!pyobj)
+            return nullptr;
+        gInstancesAllocated += 1;
+    }
+
     pyobj->fObject = nullptr;
     pyobj->fFlags = CPPInstance::kNoWrapConv;
 
@@ -459,8 +493,54 @@ static void op_dealloc(CPPInstance* pyobj)
 {
 // Remove (Python-side) memory held by the object proxy.
     PyObject_GC_UnTrack((PyObject*)pyobj);
+
+// classes that opt in have their owned objects destroyed on a background thread; the
+// object is queued only after it was unregistered, as its address may be reused
+    Cppyy::TCppObject_t deferred;
+    Cppyy::TCppScope_t klass;
+    bool isValue = false;
+    if ((pyobj->fFlags & CPPInstance::kIsOwner) &&
+            (((CPPScope*)Py_TYPE((PyObject*)pyobj))->fFlags & CPPScope::kDeferDestruct)) {
+        deferred = pyobj->GetObjectRaw();
+        if (deferred) {
+            klass   = pyobj->ObjectIsA(false /* check_smart */);
+            isValue = pyobj->fFlags & CPPInstance::kIsValue;
+            pyobj->fFlags &= ~CPPInstance::kIsOwner;
+        }
+    }
+
     op_dealloc_nofree(pyobj);
-    PyObject_GC_Del((PyObject*)pyobj);
+    if (deferred)
+        DestructionQueue::Push(klass, deferred, isValue);
+
+// the class' reference is released by the caller (subtype_dealloc), so the recycled
+// proxy keeps no reference to it; the free list is cleared when the class goes away
+    PyTypeObject* pytype = Py_TYPE((PyObject*)pyobj);
+    if (CanRecycle(pytype) && ((CPPScope*)pytype)->fNFree < gInstanceFreeListLimit) {
+        CPPScope* kls = (CPPScope*)pytype;
+        pyobj->fObject = (void*)kls->fFreeList;
+        kls->fFreeList = (PyObject*)pyobj;
+        kls->fNFree += 1;
+    } else
+        PyObject_GC_Del((PyObject*)pyobj);
+}
+
+//----------------------------------------------------------------------------
+uint32_t SetInstanceFreeListLimit(uint32_t limit)
+{
+// Set the maximum number of recycled proxies kept per class; returns the old limit.
+    uint32_t old = gInstanceFreeListLimit;
+    gInstanceFreeListLimit = limit;
+    return old;
+}
+
+//----------------------------------------------------------------------------
+void GetInstanceFreeListStats(size_t& allocated, size_t& reused, uint32_t& limit)
+{
+// Number of proxies allocated fresh and taken from a free list, and the current limit.
+    allocated = gInstancesAllocated;
+    reused    = gInstancesReused;
+    limit     = gInstanceFreeListLimit;
 }
 
 //----------------------------------------------------------------------------
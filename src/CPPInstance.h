@@ -154,6 +154,10 @@ inline bool CPPInstance_CheckExact(T* object)
 //- helper for memory regulation (no PyTypeObject equiv. member in p2.2) -----
 void op_dealloc_nofree(CPPInstance*);
 
+//- recycling of proxies through per-class free lists -------------------------
+uint32_t SetInstanceFreeListLimit(uint32_t limit);
+void GetInstanceFreeListStats(size_t& allocated, size_t& reused, uint32_t& limit);
+
 } // namespace CPyCppyy
 
 #endif // !CPYCPPYY_CPPINSTANCE_H
@@ -1,22 +1,27 @@
 // Bindings
 #include "CPyCppyy.h"
 #include "CPPMethod.h"
+#include "AsyncCall.h"
 #include "CPPExcInstance.h"
 #include "CPPInstance.h"
 #include "Converters.h"
 #include "Cppyy.h"
+#include "DirectCall.h"
 #include "Executors.h"
 #include "ProxyWrappers.h"
 #include "PyStrings.h"
 #include "TypeManip.h"
 #include "SignalTryCatch.h"
+#include "Synchronization.h"
 #include "Utility.h"
 
 #include "CPyCppyy/PyException.h"
 
 // Standard
 #include <algorithm>
+#include <chrono>
 #include <assert.h>
+#include <limits.h>
 #include <string.h>
 #include <exception>
 #include <iostream>
@@ -36,6 +41,182 @@ namespace CPyCppyy {
 }
 
 
+// maximum number of arguments of a keyword call that are reordered on the stack
+#ifndef CPYCPPYY_KWDS_MAXSTACK
+#define CPYCPPYY_KWDS_MAXSTACK 16
+#endif
+
+// maximum number of arguments for which a typed call trampoline is selected
+#ifndef CPYCPPYY_TRAMPOLINE_MAXARGS
+#define CPYCPPYY_TRAMPOLINE_MAXARGS 4
+#endif
+
+struct CPyCppyy::CPPMethod::Trampoline {
+    TypedExecute_t fExecute;                              // nullptr to use fExecutor
+    ArgUnboxer_t   fUnbox[CPYCPPYY_TRAMPOLINE_MAXARGS];
+};
+
+// number of calls per method that are timed to decide on automatic GIL release
+#ifndef CPYCPPYY_GIL_SAMPLES
+#define CPYCPPYY_GIL_SAMPLES 5
+#endif
+
+struct CPyCppyy::CPPMethod::GILSampler {
+    uint32_t fEpoch;                             // policy epoch of the samples
+    uint32_t fCount;                             // number of samples taken
+    bool     fRelease;                           // decision, once all samples are in
+    uint32_t fDurations[CPYCPPYY_GIL_SAMPLES];   // in microseconds
+};
+
+// compiled default argument expression and, if it can not change, its value
+struct CPyCppyy::CPPMethod::ArgDefault {
+    PyObject* fCode;
+    PyObject* fValue;
+};
+
+// call information that only some methods need, kept out of line to keep the (many)
+// methods that are never called, or only called plainly, small
+struct CPyCppyy::CPPMethod::ColdData {
+    std::vector<PyObject*>*  fArgNames;     // interned, for keyword calls
+    DirectCall::Signature*   fDirectCall;   // only created if kUseFFI is set
+    GILSampler*              fGILSampler;   // only created if automatic release is enabled
+    std::vector<ArgDefault>* fArgDefaults;  // compiled on first use (one per argument)
+};
+
+namespace {
+
+// Python exception type and class proxy (for copying the C++ exception) per actual
+// C++ exception class; both are kept alive for the lifetime of the module
+struct ExcTranslation {
+    PyObject* fPyExcType;
+    PyObject* fPyClass;
+};
+
+typedef std::unordered_map<Cppyy::TCppScope_t, ExcTranslation> ExcTranslations_t;
+static ExcTranslations_t gExcTranslations;
+static CPyCppyy::Mutex gExcTranslationsMutex;     // entries are never erased
+
+static const ExcTranslation* GetExcTranslation(Cppyy::TCppScope_t actual)
+{
+// the first throw of a given type does the lookup by name; failures are not cached,
+// as the Python side may become available later
+    {
+        CPyCppyy::LockGuard lock(gExcTranslationsMutex);
+        auto it = gExcTranslations.find(actual);
+        if (it != gExcTranslations.end())
+            return &it->second;
+    }
+
+    PyObject* pyexc_type = nullptr;
+    const std::string& finalname = Cppyy::GetScopedFinalName(actual);
+    const std::string& parentname = CPyCppyy::TypeManip::extract_namespace(finalname);
+    PyObject* parent = CPyCppyy::CreateScopeProxy(parentname);
+    if (parent) {
+        pyexc_type = PyObject_GetAttrString(parent,
+            parentname.empty() ? finalname.c_str() : finalname.substr(parentname.size()+2, std::string::npos).c_str());
+        Py_DECREF(parent);
+    }
+
+    PyObject* pyclass = pyexc_type ? CPyCppyy::GetScopeProxy(actual) : nullptr;
+    if (!pyclass) {
+        Py_XDECREF(pyexc_type);
+        PyErr_Clear();
+        return nullptr;
+    }
+
+    CPyCppyy::LockGuard lock(gExcTranslationsMutex);
+    auto res = gExcTranslations.emplace(actual, ExcTranslation{pyexc_type, pyclass});
+    if (!res.second) {       // concurrent lookup was first
+        Py_DECREF(pyclass);
+        Py_DECREF(pyexc_type);
+    }
+    return &res.first->second;
+}
+
+// Bases reached through virtual inheritance are at an offset that depends on the complete
+// object, so offsets to them can not be cached per derived class. The backend offers no
+// query for this, so it is answered once per derived class by a compiled check: casting
+// down from a virtual (or ambiguous, or inaccessible) base with static_cast is ill-formed.
+typedef std::unordered_map<Cppyy::TCppScope_t, std::vector<Cppyy::TCppScope_t>> FixedBases_t;
+static CPyCppyy::RCUTable<FixedBases_t> gFixedBases;
+
+static void CollectBases(Cppyy::TCppScope_t klass, std::vector<Cppyy::TCppScope_t>& bases)
+{
+    for (Cppyy::TCppIndex_t ibase = 0; ibase < Cppyy::GetNumBases(klass); ++ibase) {
+        Cppyy::TCppScope_t base = Cppyy::GetBaseScope(klass, ibase);
+        if (base && std::find(bases.begin(), bases.end(), base) == bases.end()) {
+            bases.push_back(base);
+            CollectBases(base, bases);
+        }
+    }
+}
+
+static std::vector<Cppyy::TCppScope_t> FindFixedBases(Cppyy::TCppScope_t derived)
+{
+    std::vector<Cppyy::TCppScope_t> bases, fixed;
+    CollectBases(derived, bases);
+    if (bases.empty())
+        return fixed;
+
+    static bool sTraitOk = Cppyy::Compile(
+        "namespace __cppyy_internal {\n"
+        "template<class B, class D, class = void>\n"
+        "struct fixed_base { static const bool value = false; };\n"
+        "template<class B, class D>\n"
+        "struct fixed_base<B, D, decltype((void)static_cast<D*>((B*)nullptr))> {\n"
+        "  static const bool value = true; };\n}", true /* silent */);
+    if (!sTraitOk)
+        return fixed;
+
+    static int count = 0;
+    const std::string id = std::to_string(++count);
+    const std::string& dname = Cppyy::GetScopedFinalName(derived);
+    std::ostringstream code;
+    code << "namespace __cppyy_internal {\n"
+         << "void fixed_bases" << id << "(bool* r) {\n";
+    for (size_t i = 0; i < bases.size(); ++i) {
+        code << "  r[" << i << "] = fixed_base<" << Cppyy::GetScopedFinalName(bases[i])
+             << ", " << dname << ">::value;\n";
+    }
+    code << "}\n}";
+
+    if (!Cppyy::Compile(code.str(), true /* silent */))
+        return fixed;
+
+    const auto& methods = Cppyy::GetMethodsFromName(Cppyy::GetScope("__cppyy_internal"), "fixed_bases" + id);
+    void (*check)(bool*) = methods.empty() ? nullptr :
+        (void (*)(bool*))Cppyy::GetFunctionAddress(methods[0], false);
+    if (!check)
+        return fixed;
+
+    std::unique_ptr<bool[]> result{new bool[bases.size()]()};
+    check(result.get());
+    for (size_t i = 0; i < bases.size(); ++i) {
+        if (result[i]) fixed.push_back(bases[i]);
+    }
+    return fixed;
+}
+
+static bool IsFixedBase(Cppyy::TCppScope_t derived, Cppyy::TCppScope_t base)
+{
+    {
+        const FixedBases_t& table = gFixedBases.Read();
+        auto it = table.find(derived);
+        if (it != table.end())
+            return std::find(it->second.begin(), it->second.end(), base) != it->second.end();
+    }
+
+    return gFixedBases.Update([derived, base](FixedBases_t& table) {
+        auto it = table.find(derived);
+        if (it == table.end())
+            it = table.emplace(derived, FindFixedBases(derived)).first;
+        return std::find(it->second.begin(), it->second.end(), base) != it->second.end();
+    });
+}
+
+} // unnamed namespace
+
+
 //- public helper ------------------------------------------------------------
 CPyCppyy::PyCallArgs::~PyCallArgs() {
     if (fFlags & kSelfSwap)            // if self swap, fArgs has been offset by -1
@@ -62,7 +243,7 @@ CPyCppyy::PyCallArgs::~PyCallArgs() {
 inline bool CPyCppyy::CPPMethod::VerifyArgCount_(Py_ssize_t actual)
 {
 // actual number of arguments must be between required and max args
-    Py_ssize_t maxargs = (Py_ssize_t)fConverters.size();
+    Py_ssize_t maxargs = (Py_ssize_t)fNConverters;
 
     if (maxargs != actual) {
         if (actual < (Py_ssize_t)fArgsRequired) {
@@ -85,8 +266,14 @@ inline void CPyCppyy::CPPMethod::Copy_(const CPPMethod& /* other */)
 
 // do not copy caches
     fExecutor     = nullptr;
-    fArgIndices   = nullptr;
+    fNConverters  = 0;
+    fTrampoline   = nullptr;
+    fDeclaring    = Cppyy::TCppScope_t{};
+    for (auto& bo : fBaseOffsets) bo = {Cppyy::TCppScope_t{}, 0};
+    fCold         = nullptr;
     fArgsRequired = -1;
+    fTouchesPython = false;
+    fArgMatch     = 0;
 }
 
 //----------------------------------------------------------------------------
@@ -96,12 +283,35 @@ inline void CPyCppyy::CPPMethod::Destroy_()
     if (fExecutor && fExecutor->HasState()) delete fExecutor;
     fExecutor = nullptr;
 
-    for (auto p : fConverters) {
+    Converter** converters = Converters_();
+    for (int iarg = 0; iarg < (int)fNConverters; ++iarg) {
+        Converter* p = converters[iarg];
         if (p && p->HasState()) delete p;
     }
-    fConverters.clear();
+    if (CPYCPPYY_CONVERTERS_INLINE < fNConverters)
+        delete [] fConvertersHeap;
+    fNConverters = 0;
+
+    delete fTrampoline; fTrampoline = nullptr;
+
+    if (fCold) {
+        if (fCold->fArgNames) {
+            for (auto name : *fCold->fArgNames)
+                Py_XDECREF(name);
+            delete fCold->fArgNames;
+        }
+        delete fCold->fDirectCall;
+        delete fCold->fGILSampler;
 
-    delete fArgIndices; fArgIndices = nullptr;
+        if (fCold->fArgDefaults) {
+            for (auto& d : *fCold->fArgDefaults) {
+                Py_XDECREF(d.fCode);
+                Py_XDECREF(d.fValue);
+            }
+            delete fCold->fArgDefaults;
+        }
+        delete fCold; fCold = nullptr;
+    }
     fArgsRequired = -1;
 }
 
@@ -114,7 +324,15 @@ inline PyObject* CPyCppyy::CPPMethod::ExecuteFast(
     PyObject* result = nullptr;
 
     try {       // C++ try block
-        result = fExecutor->Execute(fMethod, Cppyy::TCppObject_t((void*)((intptr_t)self+offset)), ctxt);
+        ColdData* cold = LoadOnce(fCold);
+        DirectCall::Signature* dc = cold ? LoadOnce(cold->fDirectCall) : nullptr;
+        if (!(dc && !self && (ctxt->fFlags & CallContext::kUseFFI) && DirectCall::Call(*dc, ctxt, result))) {
+            Cppyy::TCppObject_t obj = Cppyy::TCppObject_t((void*)((intptr_t)self+offset));
+            if (fTrampoline && fTrampoline->fExecute)
+                result = fTrampoline->fExecute(fMethod, obj, ctxt);
+            else
+                result = fExecutor->Execute(fMethod, obj, ctxt);
+        }
     } catch (PyException&) {
         ctxt->fFlags |= CallContext::kPyException;
         result = nullptr;           // error already set
@@ -124,45 +342,27 @@ inline PyObject* CPyCppyy::CPPMethod::ExecuteFast(
 
         ctxt->fFlags |= CallContext::kCppException;
 
-        PyObject* pyexc_type = nullptr;
-        PyObject* pyexc_obj  = nullptr;
+        PyObject* pyexc_obj = nullptr;
 
-    // TODO: factor this code with the same in ProxyWrappers (and cache it there to be able to
-    // look up based on TCppType_t):
         Cppyy::TCppScope_t actual = Cppyy::GetActualClass(exc_type, &e);
-        const std::string& finalname = Cppyy::GetScopedFinalName(actual);
-        const std::string& parentname = TypeManip::extract_namespace(finalname);
-        PyObject* parent = CreateScopeProxy(parentname);
-        if (parent) {
-            pyexc_type = PyObject_GetAttrString(parent,
-                parentname.empty() ? finalname.c_str() : finalname.substr(parentname.size()+2, std::string::npos).c_str());
-            Py_DECREF(parent);
-        }
-
-        if (pyexc_type) {
+        const ExcTranslation* trans = GetExcTranslation(actual);
+        if (trans) {
         // create a copy of the exception (TODO: factor this code with the same in ProxyWrappers)
-            PyObject* pyclass = CPyCppyy::GetScopeProxy(actual);
             PyObject* source = BindCppObjectNoCast(&e, actual);
-            PyObject* pyexc_copy = PyObject_CallFunctionObjArgs(pyclass, source, nullptr);
+            PyObject* pyexc_copy = PyObject_CallFunctionObjArgs(trans->fPyClass, source, nullptr);
             Py_DECREF(source);
-            Py_DECREF(pyclass);
             if (pyexc_copy) {
-                pyexc_obj = CPPExcInstance_Type.tp_new((PyTypeObject*)pyexc_type, nullptr, nullptr);
+                pyexc_obj = CPPExcInstance_Type.tp_new((PyTypeObject*)trans->fPyExcType, nullptr, nullptr);
                 ((CPPExcInstance*)pyexc_obj)->fCppInstance = (PyObject*)pyexc_copy;
             } else
                 PyErr_Clear();
-        } else
-            PyErr_Clear();
+        }
 
-        if (pyexc_type && pyexc_obj) {
-            PyErr_SetObject(pyexc_type, pyexc_obj);
+        if (pyexc_obj) {
+            PyErr_SetObject(trans->fPyExcType, pyexc_obj);
             Py_DECREF(pyexc_obj);
-            Py_DECREF(pyexc_type);
-        } else {
+        } else
             PyErr_Format(PyExc_Exception, "%s (C++ exception)", e.what());
-            Py_XDECREF(pyexc_obj);
-            Py_XDECREF(pyexc_type);
-        }
 
         result = nullptr;
     } catch (...) {
@@ -222,12 +422,57 @@ inline PyObject* CPyCppyy::CPPMethod::ExecuteProtected(
     return result;
 }
 
+//----------------------------------------------------------------------------
+ptrdiff_t CPyCppyy::CPPMethod::BaseOffset_(
+    CPPInstance* self, Cppyy::TCppScope_t derived, void* object)
+{
+// Offset from 'this' to the declaring class. If derived is known to be the actual (most
+// derived) class of the object and the declaring class is not a virtual base, the offset
+// is a constant and can be cached.
+    bool cacheable = (self->fFlags & CPPInstance::kIsActual) && !self->IsSmart();
+    if (cacheable) {
+        LockGuard lock(StripedLock(this));
+        for (const auto& bo : fBaseOffsets) {
+            if (bo.fDerived == derived)
+                return bo.fOffset;
+        }
+    }
+
+    ptrdiff_t offset = Cppyy::GetBaseOffset(derived, fDeclaring, object, 1 /* up-cast */);
+    if (cacheable && IsFixedBase(derived, fDeclaring)) {
+        LockGuard lock(StripedLock(this));
+        fBaseOffsets[1] = fBaseOffsets[0];
+        fBaseOffsets[0] = {derived, offset};
+    }
+
+    return offset;
+}
+
+//----------------------------------------------------------------------------
+CPyCppyy::CPPMethod::ColdData* CPyCppyy::CPPMethod::Cold_()
+{
+// out of line call information, created on first use
+    return CreateOnce(fCold, [] { return new ColdData{nullptr, nullptr, nullptr, nullptr}; });
+}
+
 //----------------------------------------------------------------------------
 bool CPyCppyy::CPPMethod::InitConverters_()
 {
 // build buffers for argument dispatching
     const size_t nArgs = Cppyy::GetMethodNumArgs(fMethod);
-    fConverters.resize(nArgs);
+    if (UINT16_MAX < nArgs) {
+        PyErr_Format(PyExc_TypeError, "too many arguments (%zu)", nArgs);
+        return false;
+    }
+
+    Converter** converters = Converters_();
+    if (fNConverters != nArgs) {      // not a retry after an earlier failure
+        converters = fConvertersInline;
+        if (CPYCPPYY_CONVERTERS_INLINE < nArgs)
+            converters = fConvertersHeap = new Converter*[nArgs];
+        std::fill(converters, converters+nArgs, nullptr);
+        fNConverters = (uint16_t)nArgs;
+    }
 
 // setup the dispatch cache
     for (int iarg = 0; iarg < (int)nArgs; ++iarg) {
@@ -239,7 +484,25 @@ bool CPyCppyy::CPPMethod::InitConverters_()
             return false;
         }
 
-        fConverters[iarg] = conv;
+        converters[iarg] = conv;
+    }
+
+// converters that can pre-check arguments for overload selection; the check is done
+// once here, so that MatchArgs_() can cast statically
+    fArgMatch = 0;
+    for (int iarg = 0; iarg < (int)nArgs && iarg < 8; ++iarg) {
+        if (dynamic_cast<ArgMatchConverter*>(converters[iarg]))
+            fArgMatch |= (uint8_t)(1 << iarg);
+    }
+
+// select the trampoline if all arguments can be unboxed directly
+    if (!fTrampoline && nArgs <= CPYCPPYY_TRAMPOLINE_MAXARGS) {
+        Trampoline tramp{};
+        bool all_builtin = true;
+        for (int iarg = 0; iarg < (int)nArgs && all_builtin; ++iarg)
+            all_builtin = (bool)(tramp.fUnbox[iarg] = GetArgUnboxer(converters[iarg]));
+        if (all_builtin)
+            fTrampoline = new Trampoline(tramp);
     }
 
     return true;
@@ -256,9 +519,43 @@ bool CPyCppyy::CPPMethod::InitExecutor_(Executor*& executor, CallContext* /* ctx
     if (!executor)
         return false;
 
+// result boxing is only specialized along with the arguments
+    if (fTrampoline)
+        fTrampoline->fExecute = GetTypedExecute(executor);
+
     return true;
 }
 
+//----------------------------------------------------------------------------
+void CPyCppyy::CPPMethod::SampleGIL_(double duration)
+{
+// record the duration of a successful call; once all samples are in, decide on the
+// GIL release based on their median
+    GILSampler* sampler = LoadOnce(fCold)->fGILSampler;
+    {
+        LockGuard lock(StripedLock(this));
+        if (CPYCPPYY_GIL_SAMPLES <= sampler->fCount)
+            return;        // recursive or concurrent call completed the samples already
+
+        sampler->fDurations[sampler->fCount++] = (uint32_t)std::min(duration, (double)UINT32_MAX);
+        if (sampler->fCount < CPYCPPYY_GIL_SAMPLES)
+            return;
+
+        uint32_t* median = sampler->fDurations + CPYCPPYY_GIL_SAMPLES/2;
+        std::nth_element(sampler->fDurations, median, sampler->fDurations + CPYCPPYY_GIL_SAMPLES);
+        if (*median <= CallContext::sGILReleaseThreshold)
+            return;
+    }
+
+// methods that call back into Python in ways not detected on Initialize(), can be
+// excluded explicitly
+    std::string scope = Cppyy::GetScopedFinalName(fScope);
+    std::string name = Cppyy::GetName(Cppyy::TCppScope_t(fMethod.data));
+    bool release = !CallContext::IsGILReleaseExcluded(scope.empty() ? name : scope + "::" + name);
+    LockGuard lock(StripedLock(this));
+    sampler->fRelease = release;
+}
+
 //----------------------------------------------------------------------------
 std::string CPyCppyy::CPPMethod::GetSignatureString(bool fa)
 {
@@ -368,8 +665,9 @@ extern std::unordered_map<Cppyy::TCppType_t, Cppyy::TCppType_t> TypeReductionMap
 //- constructors and destructor ----------------------------------------------
 CPyCppyy::CPPMethod::CPPMethod(
         Cppyy::TCppScope_t scope, Cppyy::TCppMethod_t method) :
-    fMethod(method), fScope(scope), fExecutor(nullptr), fArgIndices(nullptr),
-    fArgsRequired(-1)
+    fMethod(method), fScope(scope), fExecutor(nullptr), fTrampoline(nullptr),
+    fDeclaring(), fBaseOffsets(), fCold(nullptr), fArgsRequired(-1), fNConverters(0),
+    fTouchesPython(false), fArgMatch(0)
 {
    Cppyy::TCppType_t result = Cppyy::ResolveType(Cppyy::GetMethodReturnType(fMethod));
     if (TypeReductionMap.find(result) != TypeReductionMap.end())
@@ -643,18 +941,43 @@ PyObject* CPyCppyy::CPPMethod::GetArgDefault(int iarg, bool silent)
     if (iarg >= (int)GetMaxArgs())
         return nullptr;
 
+// use the result of an earlier evaluation, if it can not have changed, or else its
+// compiled expression
+    ColdData* cold = LoadOnce(fCold);
+    std::vector<ArgDefault>* defaults = cold ? LoadOnce(cold->fArgDefaults) : nullptr;
+    PyObject* pycode = nullptr;
+    if (defaults) {
+        LockGuard lock(StripedLock(this));
+        const ArgDefault& d = (*defaults)[iarg];
+        if (d.fValue) {
+            Py_INCREF(d.fValue);
+            return d.fValue;
+        }
+        pycode = d.fCode;
+        Py_XINCREF(pycode);
+    }
+    bool cached = (bool)pycode;
+
 // borrowed reference to cppyy.gbl module to use its dictionary to eval in
     static PyObject* gbl = PyDict_GetItemString(PySys_GetObject((char*)"modules"), "cppyy.gbl");
 
-    std::string defvalue = Cppyy::GetMethodArgDefault(fMethod, iarg);
-    if (!defvalue.empty()) {
-        PyObject** dctptr = _PyObject_GetDictPtr(gbl);
-        if (!(dctptr && *dctptr))
+    std::string defvalue;
+    if (!pycode) {
+        defvalue = Cppyy::GetMethodArgDefault(fMethod, iarg);
+        if (defvalue.empty()) {
+            PyErr_Format(PyExc_TypeError, "Could not construct default value for: %s", Cppyy::GetMethodArgName(fMethod, iarg).c_str());
             return nullptr;
+        }
+    }
 
-        PyObject* gdct = *dctptr;
-        PyObject* scope = nullptr;
+    PyObject** dctptr = _PyObject_GetDictPtr(gbl);
+    if (!(dctptr && *dctptr))
+        return nullptr;
+
+    PyObject* gdct = *dctptr;
+    PyObject* scope = nullptr;
 
+    if (!pycode) {
         if (defvalue.rfind('(') != std::string::npos) {    // constructor-style call
         // try to tickle scope creation, just in case, first look in the scope where
         // the function lives, then in the global scope
@@ -695,30 +1018,74 @@ PyObject* CPyCppyy::CPPMethod::GetArgDefault(int iarg, bool silent)
             }
         }
 
-    // attempt to evaluate the string representation (compilation is first to code to allow
-    // the error message to indicate where it's coming from)
-        PyObject* pyval = nullptr;
-
-        PyObject* pycode = Py_CompileString((char*)defvalue.c_str(), "cppyy_default_compiler", Py_eval_input);
-        if (pycode) {
-            pyval = PyEval_EvalCode(pycode, gdct, gdct);
-            Py_DECREF(pycode);
-        }
+    // compilation is first to code to allow the error message to indicate where it's
+    // coming from
+        pycode = Py_CompileString((char*)defvalue.c_str(), "cppyy_default_compiler", Py_eval_input);
+    }
 
-        if (!pyval && PyErr_Occurred() && silent) {
-            PyErr_Clear();
-            pyval = CPyCppyy_PyText_FromString(defvalue.c_str());    // allows continuation, but is likely to fail
-        }
+// attempt to evaluate the string representation
+    PyObject* pyval = nullptr;
+    if (pycode) {
+        pyval = PyEval_EvalCode(pycode, gdct, gdct);
+        if (pyval && !cached)
+            CacheArgDefault_(iarg, pycode, pyval);
+        Py_DECREF(pycode);
+    }
 
-        Py_XDECREF(scope);
-        return pyval;        // may be nullptr
+    if (!pyval && PyErr_Occurred() && silent) {
+        PyErr_Clear();
+        if (defvalue.empty())
+            defvalue = Cppyy::GetMethodArgDefault(fMethod, iarg);
+        pyval = CPyCppyy_PyText_FromString(defvalue.c_str());    // allows continuation, but is likely to fail
     }
 
-    PyErr_Format(PyExc_TypeError, "Could not construct default value for: %s", Cppyy::GetMethodArgName(fMethod, iarg).c_str());
-    return nullptr;
+    Py_XDECREF(scope);
+    return pyval;        // may be nullptr
 }
 
+//----------------------------------------------------------------------------
+CPyCppyy::CPPMethod::ArgDefault* CPyCppyy::CPPMethod::CacheArgDefault_(
+    int iarg, PyObject* pycode, PyObject* pyval)
+{
+// keep the compiled expression of a successfully evaluated default, and its value if
+// it can not change: literals of immutable builtin types (e.g. numbers, strings, and
+// None), and enum values; any other name lookup is redone, as it may find a global
+// that has been modified in the meantime
+    ColdData* cold = Cold_();
+    std::vector<ArgDefault>* defaults = CreateOnce(cold->fArgDefaults,
+        [this] { return new std::vector<ArgDefault>(GetMaxArgs(), ArgDefault{nullptr, nullptr}); });
+
+    bool invariant = false;
+    PyTypeObject* pytype = Py_TYPE(pyval);
+    if (pyval == Py_None || pytype == &PyBool_Type || pytype == &PyLong_Type || \
+            pytype == &PyFloat_Type || pytype == &PyComplex_Type || \
+            pytype == &CPyCppyy_PyText_Type || pytype == &PyBytes_Type) {
+        PyObject* names = PyObject_GetAttrString(pycode, "co_names");
+        invariant = names && PyTuple_Check(names) && PyTuple_GET_SIZE(names) == 0;
+        Py_XDECREF(names);
+        if (!names) PyErr_Clear();
+    } else if ((PyLong_Check(pyval) || CPyCppyy_PyText_Check(pyval)) && pytype->tp_dict) {
+    // enum values are read-only instances of a subclass of the underlying builtin type
+    // that is marked with the underlying C++ type (see CPPEnum.cxx)
+        invariant = PyDict_GetItem(pytype->tp_dict, PyStrings::gUnderlying) != nullptr;
+    }
+
+    LockGuard lock(StripedLock(this));
+    ArgDefault& d = (*defaults)[iarg];
+    if (d.fCode)             // concurrent evaluation was first
+        return &d;
+
+    Py_INCREF(pycode);
+    d.fCode = pycode;
+    if (invariant) {
+        Py_INCREF(pyval);
+        d.fValue = pyval;
+    }
 
+    return &d;
+}
+
+//----------------------------------------------------------------------------
 bool CPyCppyy::CPPMethod::IsConst() {
     return Cppyy::IsConstMethod(GetMethod());
 }
@@ -739,6 +1106,35 @@ Cppyy::TCppFuncAddr_t CPyCppyy::CPPMethod::GetFunctionAddress()
     return Cppyy::GetFunctionAddress(fMethod, false /* don't check fast path envar */);
 }
 
+//----------------------------------------------------------------------------
+size_t CPyCppyy::CPPMethod::GetMemoryUsage()
+{
+// The method and its call information; converters and executors are not included,
+// as most are shared between methods. The lock serializes with Initialize() and the
+// updates of the cold data, of which the pointers are only ever set once.
+    LockGuard lock(StripedLock(this));
+    size_t sz = sizeof(CPPMethod);
+    if (CPYCPPYY_CONVERTERS_INLINE < fNConverters)
+        sz += fNConverters*sizeof(Converter*);
+    if (fTrampoline)
+        sz += sizeof(Trampoline);
+
+    ColdData* cold = LoadOnce(fCold);
+    if (cold) {
+        sz += sizeof(ColdData);
+        if (const std::vector<PyObject*>* argnames = LoadOnce(cold->fArgNames))
+            sz += sizeof(std::vector<PyObject*>) + argnames->capacity()*sizeof(PyObject*);
+        if (LoadOnce(cold->fDirectCall))
+            sz += sizeof(DirectCall::Signature);
+        if (LoadOnce(cold->fGILSampler))
+            sz += sizeof(GILSampler);
+        if (const std::vector<ArgDefault>* defaults = LoadOnce(cold->fArgDefaults))
+            sz += sizeof(std::vector<ArgDefault>) + defaults->capacity()*sizeof(ArgDefault);
+    }
+
+    return sz;
+}
+
 //----------------------------------------------------------------------------
 int CPyCppyy::CPPMethod::GetArgMatchScore(PyObject* args_tuple)
 {
@@ -773,10 +1169,58 @@ int CPyCppyy::CPPMethod::GetArgMatchScore(PyObject* args_tuple)
     return score;
 }
 
+//----------------------------------------------------------------------------
+int CPyCppyy::CPPMethod::ArgMatch(CPPInstance* self,
+    CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds, CallContext* ctxt)
+{
+// only the simple case of a bound call with positional arguments is checked; for
+// the others, ProcessArgs() decides which arguments go where
+    if (!self || kwds)
+        return kMaybeMatch;
+
+    return MatchArgs_(args, nargsf, ctxt);
+}
+
+//----------------------------------------------------------------------------
+int CPyCppyy::CPPMethod::MatchArgs_(CPyCppyy_PyArgs_t args, size_t nargsf, CallContext* ctxt)
+{
+// side-effect free version of ConvertAndSetArgs(): the worst match of all arguments
+    if (!IsInitialized_() && !Initialize(ctxt)) {
+        PyErr_Clear();
+        return kMaybeMatch;     // let the actual call report the problem
+    }
+
+    Py_ssize_t argc = CPyCppyy_PyArgs_GET_SIZE(args, nargsf);
+    if (argc < (Py_ssize_t)fArgsRequired || (Py_ssize_t)fNConverters < argc)
+        return kNoMatch;
+
+    Converter** converters = Converters_();
+    int match = kExactMatch;
+    for (int i = 0; i < (int)argc; ++i) {
+    // external converters, and arguments beyond the first 8, are undecided
+        int m = (i < 8 && (fArgMatch & (1 << i))) ?
+            static_cast<ArgMatchConverter*>(converters[i])->ArgMatch(CPyCppyy_PyArgs_GET_ITEM(args, i)) :
+            (int)kMaybeMatch;
+        if (m < match) {
+            match = m;
+            if (match == kNoMatch)
+                break;
+        }
+    }
+
+    return match;
+}
+
 //----------------------------------------------------------------------------
 bool CPyCppyy::CPPMethod::Initialize(CallContext* ctxt)
 {
 // done if cache is already setup
+    if (IsInitialized_())
+        return true;
+
+// concurrent first calls (free-threaded only): one thread sets up, while the others
+// wait and then find it done; fArgsRequired is published last (see IsInitialized_())
+    LockGuard lock(StripedLock(this));
     if (fArgsRequired != -1)
         return true;
 
@@ -786,8 +1230,32 @@ bool CPyCppyy::CPPMethod::Initialize(CallContext* ctxt)
     if (!InitExecutor_(fExecutor, ctxt))
         return false;
 
+// the generated wrapper casts 'this' to the method's actual declaring class, which
+// may differ from fScope. In particular, a method brought into fScope through a
+// using-declaration (e.g. `using Base::meth;`) is still declared in the base, so
+// 'this' has to be adjusted to that base's subobject (see Call()).
+    if ((bool)fMethod)
+        fDeclaring = Cppyy::GetParentScope(Cppyy::TCppScope_t(fMethod.data));
+    if (!fDeclaring)
+        fDeclaring = fScope;
+
+// calls that may run Python code (callbacks, Python objects, or overrides in a Python
+// derived class) never release the GIL automatically
+    fTouchesPython = TouchesPython(fExecutor);
+    Converter** converters = Converters_();
+    for (int iarg = 0; iarg < (int)fNConverters && !fTouchesPython; ++iarg)
+        fTouchesPython = TouchesPython(converters[iarg]);
+    if (!fTouchesPython) {
+        PyObject* pyscope = CPyCppyy::GetScopeProxy(fScope);
+        if (pyscope) {
+            fTouchesPython = CPPScope_Check(pyscope) &&
+                (((CPPScope*)pyscope)->fFlags & CPPScope::kIsPython);
+            Py_DECREF(pyscope);
+        }
+    }
+
 // minimum number of arguments when calling
-    fArgsRequired = (int)((bool)fMethod == true ? Cppyy::GetMethodReqArgs(fMethod) : 0);
+    StoreRelease(fArgsRequired, (int)((bool)fMethod == true ? Cppyy::GetMethodReqArgs(fMethod) : 0));
 
     return true;
 }
@@ -804,39 +1272,72 @@ bool CPyCppyy::CPPMethod::ProcessKwds(PyObject* self_in, PyCallArgs& cargs)
     if (nKeys == 0 && !self_in)
         return true;
 
-    if (!fArgIndices) {
-        fArgIndices = new std::unordered_map<std::string, int>{};
-        for (int iarg = 0; iarg < (int)Cppyy::GetMethodNumArgs(fMethod); ++iarg)
-            (*fArgIndices)[Cppyy::GetMethodArgName(fMethod, iarg)] = iarg;
-    }
+    ColdData* cold = Cold_();
+    const std::vector<PyObject*>* argnames = CreateOnce(cold->fArgNames, [this] {
+    // interned, so that (the usually also interned) keyword names match by identity
+        auto names = new std::vector<PyObject*>{};
+        for (int iarg = 0; iarg < (int)Cppyy::GetMethodNumArgs(fMethod); ++iarg) {
+            names->push_back(CPyCppyy_PyText_InternFromString(
+                Cppyy::GetMethodArgName(fMethod, iarg).c_str()));
+        }
+        return names;
+    });
 
     Py_ssize_t nArgs = CPyCppyy_PyArgs_GET_SIZE(cargs.fArgs, cargs.fNArgsf) + (self_in ? 1 : 0);
     if (!VerifyArgCount_(nArgs+nKeys))
         return false;
 
-    std::vector<PyObject*> vArgs{fConverters.size()};
+// reordered arguments, on the stack for all but the longest signatures
+    PyObject* vArgsStack[CPYCPPYY_KWDS_MAXSTACK];
+    std::vector<PyObject*> vArgsHeap;
+    PyObject** vArgs = vArgsStack;
+    size_t nSlots = fNConverters;
+    if (CPYCPPYY_KWDS_MAXSTACK < nSlots) {
+        vArgsHeap.resize(nSlots);
+        vArgs = vArgsHeap.data();
+    }
+    std::fill(vArgs, vArgs+nSlots, nullptr);
 
 // next, insert the keyword values
     PyObject *key, *value;
     Py_ssize_t maxpos = -1;
 
+    const std::vector<PyObject*>& names = *argnames;
     Py_ssize_t npos_args = CPyCppyy_PyArgs_GET_SIZE(cargs.fArgs, cargs.fNArgsf);
     for (Py_ssize_t ikey = 0; ikey < nKeys; ++ikey) {
         key = PyTuple_GET_ITEM(cargs.fKwds, ikey);
         value = cargs.fArgs[npos_args+ikey];
-        const char* ckey = CPyCppyy_PyText_AsStringChecked(key);
-        if (!ckey)
-            return false;
 
-        auto p = fArgIndices->find(ckey);
-        if (p == fArgIndices->end()) {
-            SetPyError_(CPyCppyy_PyText_FromFormat("%s::%s got an unexpected keyword argument \'%s\'",
-                Cppyy::GetFinalName(fScope).c_str(), Cppyy::GetName(Cppyy::TCppScope_t(fMethod.data)).c_str(), ckey));
-            return false;
+        Py_ssize_t pos = -1;
+        for (Py_ssize_t iname = 0; iname < (Py_ssize_t)names.size(); ++iname) {
+            if (names[iname] == key) {
+                pos = iname;
+                break;
+            }
+        }
+
+        if (pos < 0) {
+        // not interned, or not a known name
+            const char* ckey = CPyCppyy_PyText_AsStringChecked(key);
+            if (!ckey)
+                return false;
+
+            for (Py_ssize_t iname = 0; iname < (Py_ssize_t)names.size(); ++iname) {
+                if (names[iname] && strcmp(CPyCppyy_PyText_AsString(names[iname]), ckey) == 0) {
+                    pos = iname;
+                    break;
+                }
+            }
+
+            if (pos < 0) {
+                SetPyError_(CPyCppyy_PyText_FromFormat("%s::%s got an unexpected keyword argument \'%s\'",
+                    Cppyy::GetFinalName(fScope).c_str(), Cppyy::GetName(Cppyy::TCppScope_t(fMethod.data)).c_str(), ckey));
+                return false;
+            }
         }
 
-        maxpos = p->second > maxpos ? p->second : maxpos;
-        vArgs[p->second] = value;      // no INCREF yet for simple cleanup in case of error
+        maxpos = pos > maxpos ? pos : maxpos;
+        vArgs[pos] = value;      // no INCREF yet for simple cleanup in case of error
     }
 
 // if maxpos < nArgs, it will be detected & reported as a duplicate below
@@ -949,21 +1450,38 @@ bool CPyCppyy::CPPMethod::ProcessArgs(PyCallArgs& cargs)
 bool CPyCppyy::CPPMethod::ConvertAndSetArgs(CPyCppyy_PyArgs_t args, size_t nargsf, CallContext* ctxt)
 {
     Py_ssize_t argc = CPyCppyy_PyArgs_GET_SIZE(args, nargsf);
-    if (!VerifyArgCount_(argc))
+    if (DeferErrors(ctxt)) {
+    // only record the failure; the full report is built if all overloads fail
+        if (argc < (Py_ssize_t)fArgsRequired || (Py_ssize_t)fNConverters < argc) {
+            ctxt->fFailReason = CallContext::kFailArgCount;
+            return false;
+        }
+    } else if (!VerifyArgCount_(argc))
         return false;
 
 // pass current scope for which the call is made
     ctxt->fCurScope = fScope;
 
+// also sets the number of arguments, which is needed even if there are none
+    Parameter* cppArgs = ctxt->GetArgs(argc);
     if (argc == 0)
         return true;
 
 // convert the arguments to the method call array
+    Converter** converters = Converters_();
     bool isOK = true;
-    Parameter* cppArgs = ctxt->GetArgs(argc);
     for (int i = 0; i < (int)argc; ++i) {
-        if (!fConverters[i]->SetArg(CPyCppyy_PyArgs_GET_ITEM(args, i), cppArgs[i], ctxt)) {
-            SetPyError_(CPyCppyy_PyText_FromFormat("could not convert argument %d: %s", i+1, fConverters[i]->GetFailureMsg().c_str()));
+        PyObject* pyarg = CPyCppyy_PyArgs_GET_ITEM(args, i);
+        if (fTrampoline && fTrampoline->fUnbox[i](pyarg, cppArgs[i]))
+            continue;
+        if (!converters[i]->SetArg(pyarg, cppArgs[i], ctxt)) {
+            if (DeferErrors(ctxt)) {
+                PyErr_Clear();
+                ctxt->fFailReason = CallContext::kFailConversion;
+                isOK = false;
+                break;
+            }
+            SetPyError_(CPyCppyy_PyText_FromFormat("could not convert argument %d: %s", i+1, converters[i]->GetFailureMsg().c_str()));
             isOK = false;
             break;
         }
@@ -978,6 +1496,57 @@ PyObject* CPyCppyy::CPPMethod::Execute(void* self, ptrdiff_t offset, CallContext
 // call the interface method
     PyObject* result = 0;
 
+// error reporting only reruns the argument conversion; a conversion succeeding now
+// means that it is state dependent, but the call is not retried out of order
+    if (ctxt->fFlags & CallContext::kConvertOnly) {
+        PyErr_SetString(PyExc_TypeError, "arguments could not be converted on first attempt");
+        return nullptr;
+    }
+
+// asynchronous calls only capture the converted call here, to be run on a worker
+    if (ctxt->fFlags & CallContext::kAsyncCall) {
+        ctxt->fAsync->fExecute = [this, self, offset](CallContext* c) {
+        // the worker only gives up the GIL if the call can not touch Python (kKeepGIL
+        // is carried over from the dispatching context)
+            if (!fTouchesPython && !(c->fFlags & CallContext::kKeepGIL))
+                c->fFlags |= CallContext::kReleaseGIL;
+            return this->Execute(self, offset, c);
+        };
+        Py_RETURN_NONE;
+    }
+
+// opt-in to bypass the wrapper for free functions with simple signatures
+    if ((ctxt->fFlags & CallContext::kUseFFI) && !self && !IsConstructor(ctxt->fFlags)) {
+        CreateOnce(Cold_()->fDirectCall, [this] {
+            auto dc = new DirectCall::Signature{};
+            DirectCall::Prepare(fMethod, *dc);
+            return dc;
+        });
+    }
+
+// opt-in to release the GIL for methods that are measured to be long running
+    GILSampler* sampler = nullptr;
+    bool autogil = false;
+    if (CallContext::sGILReleaseThreshold && !ReleasesGIL(ctxt) &&
+            !fTouchesPython && !(ctxt->fFlags & CallContext::kKeepGIL)) {
+        GILSampler* gs = CreateOnce(Cold_()->fGILSampler, [] { return new GILSampler{}; });
+
+        LockGuard lock(StripedLock(this));
+        uint32_t epoch = CallContext::sGILReleaseEpoch;
+        if (gs->fEpoch != epoch)
+            *gs = GILSampler{epoch, 0, false, {}};
+
+        if (gs->fCount < CPYCPPYY_GIL_SAMPLES)
+            sampler = gs;
+        else if (gs->fRelease) {
+            ctxt->fFlags |= CallContext::kReleaseGIL;
+            autogil = true;
+        }
+    }
+
+    std::chrono::steady_clock::time_point start;
+    if (sampler) start = std::chrono::steady_clock::now();
+
     if (CallContext::sSignalPolicy != CallContext::kProtected && \
         !(ctxt->fFlags & CallContext::kProtected)) {
     // bypasses try block (i.e. segfaults will abort)
@@ -987,6 +1556,11 @@ PyObject* CPyCppyy::CPPMethod::Execute(void* self, ptrdiff_t offset, CallContext
         result = ExecuteProtected(self, offset, ctxt);
     }
 
+    if (sampler && result)
+        SampleGIL_(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+    if (autogil)
+        ctxt->fFlags &= ~CallContext::kReleaseGIL;
+
     if (!result && PyErr_Occurred())
         SetPyError_(0);
 
@@ -998,7 +1572,7 @@ PyObject* CPyCppyy::CPPMethod::Call(CPPInstance*& self,
     CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds, CallContext* ctxt)
 {
 // setup as necessary
-    if (fArgsRequired == -1 && !Initialize(ctxt))
+    if (!IsInitialized_() && !Initialize(ctxt))
         return nullptr;
 
 // fetch self, verify, and put the arguments in usable order
@@ -1028,18 +1602,15 @@ PyObject* CPyCppyy::CPPMethod::Call(CPPInstance*& self,
 // get its class
     Cppyy::TCppScope_t derived = self->ObjectIsA();
 
-// calculate offset: the generated wrapper casts 'this' to the method's actual
-// declaring class, which may differ from fScope. In particular, a method
-// brought into fScope through a using-declaration (e.g. `using Base::meth;`)
-// is still declared in the base, so 'this' has to be adjusted to that base's
-// subobject. Using fScope here would yield a zero offset and corrupt memory.
-    Cppyy::TCppScope_t declaring = Cppyy::GetParentScope(Cppyy::TCppScope_t(fMethod.data));
-    if (!declaring)
-        declaring = fScope;
-
+// calculate offset to the declaring class (not fScope: using fScope here would yield
+// a zero offset for methods from a using-declaration and corrupt memory)
     ptrdiff_t offset = 0;
-    if (derived && derived != declaring)
-        offset = Cppyy::GetBaseOffset(derived, declaring, object, 1 /* up-cast */);
+    if (derived && derived != fDeclaring)
+        offset = BaseOffset_(self, derived, object);
+
+// virtual calls on an instance of a Python derived class may end up in Python overrides
+    if (((CPPClass*)Py_TYPE((PyObject*)self))->fFlags & CPPScope::kIsPython)
+        ctxt->fFlags |= CallContext::kKeepGIL;
 
 // actual call; recycle self instead of returning new object for same address objects
     CPPInstance* pyobj = (CPPInstance*)Execute(object, offset, ctxt);
@@ -3,6 +3,7 @@
 
 // Bindings
 #include "PyCallable.h"
+#include "Synchronization.h"
 
 // Standard
 #include <unordered_map>
@@ -10,10 +11,17 @@
 #include <vector>
 
 
+// number of argument converters that are stored in the method itself
+#ifndef CPYCPPYY_CONVERTERS_INLINE
+#define CPYCPPYY_CONVERTERS_INLINE 4
+#endif
+
+
 namespace CPyCppyy {
 
 class Executor;
 class Converter;
+namespace DirectCall { struct Signature; }
 
 class PyCallArgs {
 public:
@@ -68,15 +76,20 @@ public:
     PyCallable* Clone() override { return new CPPMethod(*this); }
 
     int       GetArgMatchScore(PyObject* args_tuple) override;
+    int       ArgMatch(CPPInstance* self,
+        CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds, CallContext* ctxt) override;
 
 public:
     PyObject* Call(CPPInstance*& self,
         CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds, CallContext* ctxt = nullptr) override;
 
+    size_t    GetMemoryUsage() override;
+
 protected:
     virtual bool ProcessArgs(PyCallArgs& args);
 
     bool Initialize(CallContext* ctxt = nullptr);
+    bool IsInitialized_() { return LoadAcquire(fArgsRequired) != -1; }
     bool ProcessKwds(PyObject* self_in, PyCallArgs& args);
     bool ConvertAndSetArgs(CPyCppyy_PyArgs_t, size_t nargsf, CallContext* ctxt = nullptr);
     PyObject* Execute(void* self, ptrdiff_t offset, CallContext* ctxt = nullptr);
@@ -87,6 +100,8 @@ protected:
     std::string         GetSignatureString(bool show_formalargs = true);
     std::string         GetReturnTypeName();
 
+    int MatchArgs_(CPyCppyy_PyArgs_t, size_t nargsf, CallContext* ctxt);
+
     virtual bool InitExecutor_(Executor*&, CallContext* ctxt = nullptr);
 
 private:
@@ -98,8 +113,19 @@ private:
     PyObject* ExecuteProtected(void*, ptrdiff_t, CallContext*);
 
     bool InitConverters_();
+    Converter** Converters_() {
+        return fNConverters <= CPYCPPYY_CONVERTERS_INLINE ? fConvertersInline : fConvertersHeap;
+    }
+    struct ColdData;
+    ColdData* Cold_();
+    ptrdiff_t BaseOffset_(CPPInstance* self, Cppyy::TCppScope_t derived, void* object);
 
     void SetPyError_(PyObject* msg);
+    struct GILSampler;
+    void SampleGIL_(double duration);
+
+    struct ArgDefault;
+    ArgDefault* CacheArgDefault_(int iarg, PyObject* pycode, PyObject* pyval);
 
 private:
 // representation
@@ -107,13 +133,43 @@ private:
     Cppyy::TCppScope_t  fScope;
     Executor*           fExecutor;
 
-// call dispatch buffers
-    std::vector<Converter*>     fConverters;
-    std::unordered_map<std::string, int>* fArgIndices;
+// argument converters, stored inline for small signatures (see Converters_())
+    union {
+        Converter*      fConvertersInline[CPYCPPYY_CONVERTERS_INLINE];
+        Converter**     fConvertersHeap;
+    };
+
+// typed unboxing of arguments and boxing of the result for small signatures of only
+// builtin scalars (selected in InitConverters_() and InitExecutor_())
+    struct Trampoline;
+    Trampoline*         fTrampoline;
+
+// declaring class of the method and offsets to it from the most recent actual
+// classes of 'this' (cached on Initialize() and Call(), respectively)
+    struct BaseOffset_t {
+        Cppyy::TCppScope_t fDerived;
+        ptrdiff_t          fOffset;
+    };
+    Cppyy::TCppScope_t  fDeclaring;
+    BaseOffset_t        fBaseOffsets[2];
+
+// call information that is only needed by some methods, created on first use
+    ColdData*           fCold;
 
 protected:
 // cached value that doubles as initialized flag (uninitialized if -1)
     int fArgsRequired;
+
+private:
+// number of argument converters (placed here to pack with fArgsRequired)
+    uint16_t fNConverters;
+
+// whether the call may run Python code or use Python objects, so that the GIL can not
+// be released automatically (set on Initialize())
+    bool fTouchesPython;
+
+// bit per leading argument whose converter is an ArgMatchConverter (see MatchArgs_())
+    uint8_t fArgMatch;
 };
 
 } // namespace CPyCppyy
@@ -19,6 +19,13 @@ public:
     PyObject* Call(CPPInstance*& self,
         CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds, CallContext* ctxt = nullptr) override;
 
+// the global stub fallback in Call() may succeed where the member conversions fail, so
+// with a stub the pre-check can not exclude this operator, nor rank it
+    int ArgMatch(CPPInstance* self,
+        CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds, CallContext* ctxt) override {
+        return fStub ? (int)kMaybeMatch : CPPMethod::ArgMatch(self, args, nargsf, kwds, ctxt);
+    }
+
 private:
     binaryfunc fStub;
 };
@@ -10,6 +10,7 @@
 #define CO_NOFREE       0x0040
 #endif
 #include "CPPOverload.h"
+#include "AsyncCall.h"
 #include "CPPInstance.h"
 #include "CallContext.h"
 #include "PyStrings.h"
@@ -27,8 +28,8 @@ namespace {
 
 // from CPython's instancemethod: Free list for method objects to safe malloc/free overhead
 // The fSelf field is used to chain the elements.
-static CPPOverload* free_list;
-static int numfree = 0;
+static CPYCPPYY_FREELIST_LOCAL CPPOverload* free_list;
+static CPYCPPYY_FREELIST_LOCAL int numfree = 0;
 #ifndef CPPOverload_MAXFREELIST
 #define CPPOverload_MAXFREELIST 32
 #endif
@@ -151,8 +152,8 @@ static inline void ResetCallState(CPPInstance* descr_self, CPPInstance*& im_self
     }
 }
 
-// helper to factor out return logic of mp_call / mp_vectorcall
-static inline PyObject* HandleReturn(
+// ownership and lifeline handling of the result of a successful call
+static inline PyObject* ProcessReturn(
     CPPOverload* pymeth, CPPInstance* im_self, PyObject* result)
 {
 // special case for python exceptions, propagated through C++ layer
@@ -207,6 +208,21 @@ static inline PyObject* HandleReturn(
         }
     }
 
+    return result;
+}
+
+// helper to factor out return logic of mp_call / mp_vectorcall
+static inline PyObject* HandleReturn(
+    CPPOverload* pymeth, CPPInstance* im_self, PyObject* result, CallContext& ctxt)
+{
+    if (result && ctxt.fAsync && ctxt.fAsync->fExecute) {
+    // placeholder result of an asynchronous call: the actual result is processed on
+    // completion (see mp_async), which needs self
+        Py_XINCREF((PyObject*)im_self);
+        ctxt.fAsync->fSelf = im_self;
+    } else
+        result = ProcessReturn(pymeth, im_self, result);
+
 // reset self as necessary to allow re-use of the CPPOverload
     ResetCallState(pymeth->fSelf, im_self);
 
@@ -555,7 +571,7 @@ static PyGetSetDef mp_getset[] = {
     {(char*)"__release_gil__",     (getter)mp_getthreaded, (setter)mp_setthreaded,
       (char*)"If true, releases GIL on call into C++", nullptr},
     {(char*)"__useffi__",          (getter)mp_getuseffi, (setter)mp_setuseffi,
-      (char*)"not implemented", nullptr},
+      (char*)"If true, call simple free functions through their address, bypassing the wrapper", nullptr},
     {(char*)"__sig2exc__",         (getter)mp_getsig2exc, (setter)mp_setsig2exc,
       (char*)"If true, turn signals into Python exceptions", nullptr},
 
@@ -566,52 +582,67 @@ static PyGetSetDef mp_getset[] = {
 };
 
 //= CPyCppyy method proxy function behavior ==================================
-static PyObject* mp_vectorcall(
-    CPPOverload* pymeth, PyObject* const *args, size_t nargsf, PyObject* kwds)
+static inline void InitCallContext(CPPOverload* pymeth, CallContext& ctxt)
 {
-// Call the appropriate overload of this method.
-
-// If called from a descriptor, then this could be a bound function with
-// non-zero self; otherwise pymeth->fSelf is expected to always be nullptr.
-
-    CPPInstance* im_self = pymeth->fSelf;
-
-// get local handles to proxy internals
-    auto& methods = pymeth->fMethodInfo->fMethods;
-
-    CPPOverload::Methods_t::size_type nMethods = methods.size();
-
-    CallContext ctxt{};
-    const auto mflags = pymeth->fMethodInfo->fFlags;
+// setup the call context from the overload's settings
+    const uint32_t mflags = pymeth->fMethodInfo->fFlags;
     const auto mempolicy = (mflags & (CallContext::kUseHeuristics | CallContext::kUseStrict));
     ctxt.fFlags |= mempolicy ? mempolicy : (uint64_t)CallContext::sMemoryPolicy;
     ctxt.fFlags |= (mflags & CallContext::kReleaseGIL);
+    ctxt.fFlags |= (mflags & CallContext::kUseFFI);
     ctxt.fFlags |= (mflags & CallContext::kProtected);
     if (IsConstructor(pymeth->fMethodInfo->fFlags)) ctxt.fFlags |= CallContext::kIsConstructor;
     ctxt.fFlags |= (pymeth->fFlags & (CallContext::kCallDirect | CallContext::kFromDescr));
-    ctxt.fPyContext = (PyObject*)im_self;  // no Py_INCREF as no ownership
+    ctxt.fPyContext = (PyObject*)pymeth->fSelf;  // no Py_INCREF as no ownership
 
 // check implicit conversions status (may be disallowed to prevent recursion)
     ctxt.fFlags |= (pymeth->fFlags & CallContext::kNoImplicit);
+}
+
+static inline void Memoize(CPPOverload::MethodInfo_t* info, uint64_t sighash, PyCallable* pc)
+{
+    LockGuard lock(info->fMutex);
+    info->fDispatchMap.Insert(sighash, pc);
+}
+
+static PyObject* Dispatch(
+    CPPOverload* pymeth, PyObject* const *args, size_t nargsf, PyObject* kwds, CallContext& ctxt)
+{
+// Call the appropriate overload of this method.
+
+// If called from a descriptor, then this could be a bound function with
+// non-zero self; otherwise pymeth->fSelf is expected to always be nullptr.
+
+    CPPInstance* im_self = pymeth->fSelf;
+
+// get local handles to proxy internals; the methods are owned by the shared method
+// info, and live as long as it does, so can be used outside of the lock
+    CPPOverload::MethodInfo_t* info = pymeth->fMethodInfo;
 
 // simple case
-    if (nMethods == 1) {
+    PyCallable* single = nullptr;
+    {
+        LockGuard lock(info->fMutex);
+        if (info->fMethods.size() == 1)
+            single = info->fMethods[0];
+    }
+
+    if (single) {
         if (!NoImplicit(&ctxt)) ctxt.fFlags |= CallContext::kAllowImplicit;    // no two rounds needed
-        PyObject* result = methods[0]->Call(im_self, args, nargsf, kwds, &ctxt);
-        return HandleReturn(pymeth, im_self, result);
+        PyObject* result = single->Call(im_self, args, nargsf, kwds, &ctxt);
+        return HandleReturn(pymeth, im_self, result, ctxt);
     }
 
-// otherwise, handle overloading
+// otherwise, handle overloading; errors of failing candidates are only recorded, the
+// full report is created if no overload succeeds
     uint64_t sighash = HashSignature(args, nargsf);
+    ctxt.fFlags |= CallContext::kDeferErrors;
 
 // look for known signatures ...
-    auto& dispatchMap = pymeth->fMethodInfo->fDispatchMap;
     PyCallable* memoized_pc = nullptr;
-    for (const auto& p : dispatchMap) {
-        if (p.first == sighash) {
-            memoized_pc = p.second;
-            break;
-        }
+    {
+        LockGuard lock(info->fMutex);
+        memoized_pc = info->fDispatchMap.Find(sighash);
     }
     if (memoized_pc) {
     // it is necessary to enable implicit conversions as the memoized call may be from
@@ -619,75 +650,103 @@ static PyObject* mp_vectorcall(
         if (!NoImplicit(&ctxt)) ctxt.fFlags |= CallContext::kAllowImplicit;
         PyObject* result = memoized_pc->Call(im_self, args, nargsf, kwds, &ctxt);
         if (result)
-            return HandleReturn(pymeth, im_self, result);
+            return HandleReturn(pymeth, im_self, result, ctxt);
 
     // fall through: python is dynamic, and so, the hashing isn't infallible
         ctxt.fFlags &= ~CallContext::kAllowImplicit;
+        ctxt.fFailReason = CallContext::kFailNone;
         PyErr_Clear();
         ResetCallState(pymeth->fSelf, im_self);
     }
 
-// ... otherwise loop over all methods and find the one that does not fail
-    if (!IsSorted(mflags)) {
-    // sorting is based on priority, which is not stored on the method as it is used
-    // only once, so copy the vector of methods into one where the priority can be
-    // stored during sorting
-        std::vector<std::pair<int, PyCallable*>> pm; pm.reserve(methods.size());
-        for (auto ptr : methods)
-            pm.emplace_back(ptr->GetPriority(), ptr);
-        std::stable_sort(pm.begin(), pm.end(), PriorityCmp);
-        for (CPPOverload::Methods_t::size_type i = 0; i < methods.size(); ++i)
-            methods[i] = pm[i].second;
-        pymeth->fMethodInfo->fFlags |= CallContext::kIsSorted;
+// ... otherwise loop over all methods and find the one that does not fail; without
+// the GIL, methods may be added concurrently, so the loop runs over a snapshot
+#ifdef Py_GIL_DISABLED
+    CPPOverload::Methods_t methods;
+#else
+    CPPOverload::Methods_t& methods = info->fMethods;
+#endif
+    {
+        LockGuard lock(info->fMutex);
+        CPPOverload::Methods_t& current = info->fMethods;
+        if (!IsSorted(info->fFlags)) {
+        // sorting is based on priority, which is not stored on the method as it is used
+        // only once, so copy the vector of methods into one where the priority can be
+        // stored during sorting
+            std::vector<std::pair<int, PyCallable*>> pm; pm.reserve(current.size());
+            for (auto ptr : current)
+                pm.emplace_back(ptr->GetPriority(), ptr);
+            std::stable_sort(pm.begin(), pm.end(), PriorityCmp);
+            for (CPPOverload::Methods_t::size_type i = 0; i < current.size(); ++i)
+                current[i] = pm[i].second;
+            info->fFlags |= CallContext::kIsSorted;
+        }
+#ifdef Py_GIL_DISABLED
+        methods = current;
+#endif
     }
+    CPPOverload::Methods_t::size_type nMethods = methods.size();
 
     std::vector<Utility::PyError_t> errors;
     std::vector<bool> implicit_possible(methods.size());
+    std::vector<CPPOverload::Methods_t::size_type> deferred;    // first stage failures, report deferred
     for (int stage = 0; stage < 2; ++stage) {
         bool bHaveImplicit = false;
         for (CPPOverload::Methods_t::size_type i = 0; i < nMethods; ++i) {
             if (stage && !implicit_possible[i])
                 continue;    // did not set implicit conversion, so don't try again
 
-            PyObject* result = methods[i]->Call(im_self, args, nargsf, kwds, &ctxt);
-            if (result) {
-            // success: update the dispatch map for subsequent calls
-                if (!memoized_pc)
-                    dispatchMap.push_back(std::make_pair(sighash, methods[i]));
-                else {
-                // debatable: apparently there are two methods that map onto the same sighash
-                // and preferring the latest may result in "ping pong."
-                    for (auto& p : dispatchMap) {
-                        if (p.first == sighash) {
-                            p.second = methods[i];
-                            break;
-                        }
+            if (stage == 0) {
+            // cheap pre-check to skip candidates that are certain to fail the first stage;
+            // their (expensive) error reports are only generated if all candidates fail
+                int match = methods[i]->ArgMatch(im_self, args, nargsf, kwds, &ctxt);
+                if (match < kMaybeMatch) {
+                    deferred.push_back(i);
+                    if (match == kImplicitMatch && !NoImplicit(&ctxt)) {
+                        bHaveImplicit = true;
+                        implicit_possible[i] = true;
                     }
+                    continue;
                 }
+            }
 
-                return HandleReturn(pymeth, im_self, result);
+            PyObject* result = methods[i]->Call(im_self, args, nargsf, kwds, &ctxt);
+            if (result) {
+            // success: update the dispatch map for subsequent calls (debatable: if memoized_pc
+            // is set, there are two methods that map onto the same sighash and preferring the
+            // latest may result in "ping pong.")
+                Memoize(info, sighash, methods[i]);
+
+                return HandleReturn(pymeth, im_self, result, ctxt);
             }
 
         // else failure ..
             if (stage != 0) {
                 PyErr_Clear();    // first stage errors should be the more informative
+                ctxt.fFailReason = CallContext::kFailNone;
                 ResetCallState(pymeth->fSelf, im_self);
                 continue;
             }
 
-        // collect error message/trace (automatically clears exception, too)
-            if (!PyErr_Occurred()) {
-            // this should not happen; set an error to prevent core dump and report
-                PyObject* sig = methods[i]->GetPrototype();
-                PyErr_Format(PyExc_SystemError, "%s =>\n    %s",
-                    CPyCppyy_PyText_AsString(sig), (char*)"nullptr result without error in overload call");
-                Py_DECREF(sig);
-            }
+            if (ctxt.fFailReason != CallContext::kFailNone) {
+            // argument failure: record only, the error report is built if all fail
+                deferred.push_back(i);
+                ctxt.fFailReason = CallContext::kFailNone;
+            } else {
+            // collect error message/trace (automatically clears exception, too)
+                if (!PyErr_Occurred()) {
+                // this should not happen; set an error to prevent core dump and report
+                    PyObject* sig = methods[i]->GetPrototype();
+                    PyErr_Format(PyExc_SystemError, "%s =>\n    %s",
+                        CPyCppyy_PyText_AsString(sig), (char*)"nullptr result without error in overload call");
+                    Py_DECREF(sig);
+                }
 
-        // retrieve, store, and clear errors
-            bool callee_error = ctxt.fFlags & (CallContext::kPyException | CallContext::kCppException);
-            ctxt.fFlags &= ~(CallContext::kPyException | CallContext::kCppException);
-            Utility::FetchError(errors, callee_error);
+            // retrieve, store, and clear errors
+                bool callee_error = ctxt.fFlags & (CallContext::kPyException | CallContext::kCppException);
+                ctxt.fFlags &= ~(CallContext::kPyException | CallContext::kCppException);
+                Utility::FetchError(errors, callee_error);
+            }
 
             if (HaveImplicit(&ctxt)) {
                 bHaveImplicit = true;
@@ -705,6 +764,34 @@ static PyObject* mp_vectorcall(
         ctxt.fFlags |= CallContext::kAllowImplicit;
     }
 
+// all failed: rerun the argument conversion of the candidates with deferred failures
+// in first stage mode to generate their full error reports (these candidates are never
+// executed), and merge them in overload order
+    if (!deferred.empty()) {
+        ctxt.fFlags &= ~(CallContext::kDeferErrors | CallContext::kAllowImplicit | CallContext::kHaveImplicit);
+        ctxt.fFlags |= CallContext::kConvertOnly;
+        std::vector<Utility::PyError_t> all_errors;
+        all_errors.reserve(nMethods);
+        auto ierr = errors.begin();
+        auto idef = deferred.begin();
+        for (CPPOverload::Methods_t::size_type i = 0; i < nMethods; ++i) {
+            if (idef == deferred.end() || *idef != i) {
+                if (ierr != errors.end())
+                    all_errors.push_back(std::move(*ierr++));
+                continue;
+            }
+            ++idef;
+
+            Py_XDECREF(methods[i]->Call(im_self, args, nargsf, kwds, &ctxt));   // always fails
+
+            bool callee_error = ctxt.fFlags & (CallContext::kPyException | CallContext::kCppException);
+            ctxt.fFlags &= ~(CallContext::kPyException | CallContext::kCppException | CallContext::kHaveImplicit);
+            Utility::FetchError(all_errors, callee_error);
+            ResetCallState(pymeth->fSelf, im_self);
+        }
+        errors.swap(all_errors);
+    }
+
 // first summarize, then add details
     PyObject* topmsg = CPyCppyy_PyText_FromFormat(
         "none of the %d overloaded methods succeeded. Full details:", (int)nMethods);
@@ -714,6 +801,14 @@ static PyObject* mp_vectorcall(
     return nullptr;
 }
 
+static PyObject* mp_vectorcall(
+    CPPOverload* pymeth, PyObject* const *args, size_t nargsf, PyObject* kwds)
+{
+    CallContext ctxt{};
+    InitCallContext(pymeth, ctxt);
+    return Dispatch(pymeth, args, nargsf, kwds, ctxt);
+}
+
 //----------------------------------------------------------------------------
 static PyObject* mp_str(CPPOverload* cppinst)
 {
@@ -889,6 +984,50 @@ static PyObject* mp_add_overload(CPPOverload* pymeth, PyObject* new_overload)
     Py_RETURN_NONE;
 }
 
+static PyObject* AsyncFinish(AsyncCall* call, PyObject* result)
+{
+    return ProcessReturn((CPPOverload*)call->fOwner, call->fSelf, result);
+}
+
+static PyObject* mp_async(CPPOverload* pymeth, PyObject* const *args, Py_ssize_t nargs, PyObject* kwnames)
+{
+// Select the overload and convert the arguments now, then run the C++ call on a
+// worker thread with the GIL released; returns an asyncio future for the result.
+    if (IsConstructor(pymeth->fMethodInfo->fFlags)) {
+        PyErr_SetString(PyExc_TypeError, "constructors can not be called asynchronously");
+        return nullptr;
+    }
+
+    AsyncCall* call = AsyncCall::Create();
+    if (!call)
+        return nullptr;
+
+// the converted arguments may refer to the Python ones, so keep all alive
+    Py_INCREF((PyObject*)pymeth);
+    call->KeepAlive((PyObject*)pymeth);
+    for (Py_ssize_t i = 0; i < nargs; ++i) {
+        Py_INCREF(args[i]);
+        call->KeepAlive(args[i]);
+    }
+    if (kwnames) {
+        for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE(kwnames); ++i) {
+            Py_INCREF(args[nargs+i]);
+            call->KeepAlive(args[nargs+i]);
+        }
+    }
+    call->fOwner  = (PyObject*)pymeth;
+    call->fFinish = &AsyncFinish;
+
+    InitCallContext(pymeth, call->fCtxt);
+    PyObject* result = Dispatch(pymeth, args, (size_t)nargs, kwnames, call->fCtxt);
+    if (!result) {
+        delete call;
+        return nullptr;
+    }
+
+    return call->Submit(result);
+}
+
 static PyObject* mp_reflex(CPPOverload* pymeth, PyObject* args)
 {
 // Provide the requested reflection information.
@@ -906,6 +1045,8 @@ static PyMethodDef mp_methods[] = {
       (char*)"select overload for dispatch" },
     {(char*)"__add_overload__", (PyCFunction)mp_add_overload, METH_O,
       (char*)"add a new overload" },
+    {(char*)"__async__",        (PyCFunction)(void(*)(void))mp_async, METH_FASTCALL | METH_KEYWORDS,
+      (char*)"call in a worker thread, returning an asyncio future" },
     {(char*)"__cpp_reflex__",   (PyCFunction)mp_reflex, METH_VARARGS,
       (char*)"C++ overload reflection information" },
     {(char*)nullptr, nullptr, 0, nullptr }
@@ -977,8 +1118,11 @@ void CPyCppyy::CPPOverload::Set(const std::string& name, std::vector<PyCallable*
 {
 // Fill in the data of a freshly created method proxy.
     fMethodInfo->fName = name;
-    fMethodInfo->fMethods.swap(methods);
-    fMethodInfo->fFlags &= ~CallContext::kIsSorted;
+    {
+        LockGuard lock(fMethodInfo->fMutex);
+        fMethodInfo->fMethods.swap(methods);
+        fMethodInfo->fFlags &= ~CallContext::kIsSorted;
+    }
 
 // special case: all constructors are considered creators by default
     if (name == "__init__")
@@ -996,6 +1140,7 @@ void CPyCppyy::CPPOverload::Set(const std::string& name, std::vector<PyCallable*
 void CPyCppyy::CPPOverload::AdoptMethod(PyCallable* pc)
 {
 // Fill in the data of a freshly created method proxy.
+    LockGuard lock(fMethodInfo->fMutex);
     fMethodInfo->fMethods.push_back(pc);
     fMethodInfo->fFlags &= ~CallContext::kIsSorted;
 }
@@ -1003,13 +1148,40 @@ void CPyCppyy::CPPOverload::AdoptMethod(PyCallable* pc)
 //----------------------------------------------------------------------------
 void CPyCppyy::CPPOverload::MergeOverload(CPPOverload* meth)
 {
-    if (!HasMethods()) // if fresh method being filled: also copy flags
-        fMethodInfo->fFlags = meth->fMethodInfo->fFlags;
-    fMethodInfo->fMethods.insert(fMethodInfo->fMethods.end(),
-        meth->fMethodInfo->fMethods.begin(), meth->fMethodInfo->fMethods.end());
+// take the methods from meth first, to not hold both locks at the same time
+    Methods_t methods;
+    uint32_t flags;
+    {
+        LockGuard lock(meth->fMethodInfo->fMutex);
+        methods.swap(meth->fMethodInfo->fMethods);
+        meth->fMethodInfo->fDispatchMap.Clear();
+        flags = meth->fMethodInfo->fFlags;
+    }
+
+    LockGuard lock(fMethodInfo->fMutex);
+    if (fMethodInfo->fMethods.empty()) // if fresh method being filled: also copy flags
+        fMethodInfo->fFlags = flags;
+    fMethodInfo->fMethods.insert(fMethodInfo->fMethods.end(), methods.begin(), methods.end());
     fMethodInfo->fFlags &= ~CallContext::kIsSorted;
-    meth->fMethodInfo->fDispatchMap.clear();
-    meth->fMethodInfo->fMethods.clear();
+}
+
+//----------------------------------------------------------------------------
+size_t CPyCppyy::CPPOverload::GetMemoryUsage(size_t* nmethods) const
+{
+    LockGuard lock(fMethodInfo->fMutex);
+    const MethodInfo_t* info = fMethodInfo;
+
+    size_t sz = sizeof(CPPOverload) + sizeof(MethodInfo_t) + sizeof(SharedCount_t);
+    sz += info->fName.capacity();
+    sz += info->fMethods.capacity()*sizeof(PyCallable*);
+    sz += info->fDispatchMap.MemoryUsage();
+    for (auto pc : info->fMethods)
+        sz += pc->GetMemoryUsage();
+
+    if (nmethods)
+        *nmethods += info->fMethods.size();
+
+    return sz;
 }
 
 //----------------------------------------------------------------------------
@@ -1059,7 +1231,7 @@ PyObject* CPyCppyy::CPPOverload::FindOverload(const std::string& signature, int
                     Py_INCREF(fSelf);
                     newmeth->fSelf = fSelf;
                 }
-                newmeth->fMethodInfo->fFlags = fMethodInfo->fFlags;
+                newmeth->fMethodInfo->fFlags = (uint32_t)fMethodInfo->fFlags;
             } else
                 newmeth->AdoptMethod(meth->Clone());
 
@@ -1130,7 +1302,7 @@ PyObject* CPyCppyy::CPPOverload::FindOverload(PyObject *args_tuple, int want_con
         Py_INCREF(fSelf);
         newmeth->fSelf = fSelf;
     }
-    newmeth->fMethodInfo->fFlags = fMethodInfo->fFlags;
+    newmeth->fMethodInfo->fFlags = (uint32_t)fMethodInfo->fFlags;
 
     return (PyObject*) newmeth;
 }
@@ -2,7 +2,9 @@
 #define CPYCPPYY_CPPOVERLOAD_H
 
 // Bindings
+#include "DispatchMap.h"
 #include "PyCallable.h"
+#include "Synchronization.h"
 
 // Standard
 #include <map>
@@ -40,21 +42,24 @@ inline uint64_t HashSignature(CPyCppyy_PyArgs_t args, size_t nargsf)
 
 class CPPOverload {
 public:
-    typedef std::vector<std::pair<uint64_t, PyCallable*>> DispatchMap_t;
+    typedef DispatchMap<PyCallable*> DispatchMap_t;
     typedef std::vector<PyCallable*> Methods_t;
 
     struct MethodInfo_t {
         MethodInfo_t() : fDoc(nullptr), fFlags(CallContext::kNone)
-            { fRefCount = new int(1); }
+            { fRefCount = new SharedCount_t(1); }
         ~MethodInfo_t();
 
         std::string                 fName;
         CPPOverload::DispatchMap_t  fDispatchMap;
         CPPOverload::Methods_t      fMethods;
         PyObject*                   fDoc;
-        uint32_t                    fFlags;
+        SharedFlags_t               fFlags;
 
-        int* fRefCount;
+    // guards fDispatchMap and fMethods (incl. their sorting) on free-threaded builds
+        Mutex fMutex;
+
+        SharedCount_t* fRefCount;
 
     private:
         MethodInfo_t(const MethodInfo_t&) = delete;
@@ -67,7 +72,13 @@ public:
     void MergeOverload(CPPOverload* meth);
 
     const std::string& GetName() const { return fMethodInfo->fName; }
-    bool HasMethods() const { return !fMethodInfo->fMethods.empty(); }
+    bool HasMethods() const {
+        LockGuard lock(fMethodInfo->fMutex);
+        return !fMethodInfo->fMethods.empty();
+    }
+
+// (approximate) number of bytes held by this overload set and its methods
+    size_t GetMemoryUsage(size_t* nmethods = nullptr) const;
 
 // find a method based on the provided signature
     PyObject* FindOverload(const std::string& signature, int want_const = -1);
@@ -4,10 +4,12 @@
 #include "CPPDataMember.h"
 #include "CPPEnum.h"
 #include "CPPFunction.h"
+#include "CPPInstance.h"
 #include "CPPOverload.h"
 #include "Cppyy.h"
 #include "CustomPyTypes.h"
 #include "Dispatcher.h"
+#include "MemoryRegulator.h"
 #include "ProxyWrappers.h"
 #include "PyStrings.h"
 #include "TemplateProxy.h"
@@ -80,8 +82,11 @@ static void meta_dealloc(CPPScope* scope)
             for (auto pyobj : *scope->fImp.fUsing) Py_DECREF(pyobj);
             delete scope->fImp.fUsing; scope->fImp.fUsing = nullptr;
         }
-    } else if (!(scope->fFlags & CPPScope::kIsPython)) {
-        delete scope->fImp.fCppObjects; scope->fImp.fCppObjects = nullptr;
+    }
+    while (scope->fFreeList) {
+        PyObject* next = (PyObject*)((CPPInstance*)scope->fFreeList)->fObject;
+        PyObject_GC_Del(scope->fFreeList);
+        scope->fFreeList = next;
     }
     delete scope->fOperators;
     free(scope->fModuleName);
@@ -224,6 +229,8 @@ static PyObject* pt_new(PyTypeObject* subtype, PyObject* args, PyObject* kwds)
     result->fFlags      = CPPScope::kNone;
     result->fOperators  = nullptr;
     result->fModuleName = nullptr;
+    result->fFreeList   = nullptr;
+    result->fNFree      = 0;
 
     if (raw && deref) {
         result->fFlags |= CPPScope::kIsSmart;
@@ -279,26 +286,36 @@ static PyObject* pt_new(PyTypeObject* subtype, PyObject* args, PyObject* kwds)
     if (!result->fCppType)
         return (PyObject*)result;
 
-// maps for using namespaces and tracking objects
+// map for using namespaces (objects are tracked by C++ class in the MemoryRegulator,
+// so Python-side derived classes share the tracking of their C++ base automatically)
+    result->fImp.fUsing = nullptr;
     if (!Cppyy::IsNamespace(result->fCppType)) {
         static Cppyy::TCppScope_t exc_type = Cppyy::GetScope("exception", Cppyy::GetScope("std"));
         if (Cppyy::IsSubclass(result->fCppType, exc_type))
             result->fFlags |= CPPScope::kIsException;
-        if (!(result->fFlags & CPPScope::kIsPython))
-            result->fImp.fCppObjects = new CppToPyMap_t;
-        else {
-        // special case: the C++ objects should be stored with the associated C++, not Python, type
-            CPPClass* kls = (CPPClass*)GetScopeProxy(result->fCppType);
-            if (kls) {
-                result->fImp.fCppObjects = kls->fImp.fCppObjects;
-                Py_DECREF(kls);
-            } else
-                result->fImp.fCppObjects = nullptr;
-        }
-    } else {
-        result->fImp.fUsing = nullptr;
+        if (!MemoryRegulator::IsTracked(result->fCppType))
+            result->fFlags |= CPPScope::kNoMemReg;
+#ifndef Py_GIL_DISABLED
+    // instance proxies can be recycled if allocating one takes no more than the generic
+    // allocation, i.e. no instance dict or weak references managed by the interpreter
+        PyTypeObject* pytype = (PyTypeObject*)result;
+        if (!(result->fFlags & CPPScope::kIsPython) && pytype->tp_itemsize == 0 &&
+                pytype->tp_alloc == PyType_GenericAlloc && pytype->tp_free == PyObject_GC_Del &&
+                !pytype->tp_finalize && !pytype->tp_del
+#ifdef Py_TPFLAGS_MANAGED_DICT
+                && !(pytype->tp_flags & Py_TPFLAGS_MANAGED_DICT)
+#endif
+#ifdef Py_TPFLAGS_MANAGED_WEAKREF
+                && !(pytype->tp_flags & Py_TPFLAGS_MANAGED_WEAKREF)
+#endif
+#ifdef Py_TPFLAGS_INLINE_VALUES
+                && !(pytype->tp_flags & Py_TPFLAGS_INLINE_VALUES)
+#endif
+            )
+            result->fFlags |= CPPScope::kRecycleProxies;
+#endif
+    } else
         result->fFlags |= CPPScope::kIsNamespace;
-    }
 
     if (PyErr_Occurred()) {
         Py_DECREF((PyObject*)result);
@@ -36,7 +36,6 @@ namespace CPyCppyy {
       @version 2.0
  */
 
-typedef std::unordered_map<Cppyy::TCppObject_t, PyObject*> CppToPyMap_t;
 namespace Utility { struct PyOperators; }
 
 class CPPScope {
@@ -53,18 +52,22 @@ public:
         kActiveImplicitCall      = 0x0080,
         kNoOSInsertion           = 0x0100,
         kGblOSInsertion          = 0x0200,
-        kNoPrettyPrint           = 0x0400 };
+        kNoPrettyPrint           = 0x0400,
+        kNoMemReg                = 0x0800,      // objects are not identity tracked
+        kDeferDestruct           = 0x1000,      // owned objects destroyed off-GIL
+        kRecycleProxies          = 0x2000 };    // instance proxies use a free list
 
 public:
     PyHeapTypeObject   fType;
     Cppyy::TCppScope_t fCppType;
     uint32_t           fFlags;
     union {
-        CppToPyMap_t*           fCppObjects;     // classes only
         std::vector<PyObject*>* fUsing;          // namespaces only
     } fImp;
     Utility::PyOperators*       fOperators;
     char*             fModuleName;
+    PyObject*         fFreeList;        // recycled instance proxies (see CPPInstance.cxx)
+    uint32_t          fNFree;
 
 private:
     CPPScope() = delete;
@@ -108,9 +111,11 @@ inline CPPScope* CPPScopeMeta_New(Cppyy::TCppScope_t klass, PyObject* args)
 // set the klass id, for instances and Python-side derived classes to pick up
     pymeta->fCppType         = klass;
     pymeta->fFlags           = CPPScope::kIsMeta;
-    pymeta->fImp.fCppObjects = nullptr;
+    pymeta->fImp.fUsing      = nullptr;
     pymeta->fOperators       = nullptr;
     pymeta->fModuleName      = nullptr;
+    pymeta->fFreeList        = nullptr;
+    pymeta->fNFree           = 0;
 
     return pymeta;
 }
@@ -9,10 +9,12 @@
 #include "CPPScope.h"
 #include "Cppyy.h"
 #include "CustomPyTypes.h"
+#include "DestructionQueue.h"
 #include "LowLevelViews.h"
 #include "MemoryRegulator.h"
 #include "ProxyWrappers.h"
 #include "PyStrings.h"
+#include "Pythonize.h"
 #include "TemplateProxy.h"
 #include "TupleOfInstances.h"
 #include "Utility.h"
@@ -862,6 +864,174 @@ static PyObject* SetGlobalSignalPolicy(PyObject*, PyObject* args)
     Py_RETURN_FALSE;
 }
 
+//----------------------------------------------------------------------------
+static PyObject* SetGILReleasePolicy(PyObject*, PyObject* args)
+{
+// Set the median call duration (in microseconds) above which methods automatically
+// release the GIL; 0 (the default) disables. Returns the previous threshold.
+    PyObject* threshold = nullptr;
+    if (!PyArg_ParseTuple(args, const_cast<char*>("O!"), &PyInt_Type, &threshold))
+        return nullptr;
+
+    long l = PyInt_AsLong(threshold);
+    if ((l == -1 && PyErr_Occurred()) || l < 0 || (long)UINT32_MAX < l) {
+        PyErr_Clear();
+        PyErr_Format(PyExc_ValueError, "threshold should be between 0 and %lu microseconds", (unsigned long)UINT32_MAX);
+        return nullptr;
+    }
+
+    return PyLong_FromUnsignedLong(CallContext::SetGILReleasePolicy((uint32_t)l));
+}
+
+//----------------------------------------------------------------------------
+static PyObject* AddGILReleaseExclusion(PyObject*, PyObject* args)
+{
+// Exclude a method, by scoped name, from automatic GIL release.
+    const char* name = nullptr;
+    if (!PyArg_ParseTuple(args, const_cast<char*>("s"), &name))
+        return nullptr;
+
+    CallContext::AddGILReleaseExclusion(name);
+    Py_RETURN_NONE;
+}
+
+//----------------------------------------------------------------------------
+static PyObject* SetMapIterTuplePolicy(PyObject*, PyObject* args)
+{
+// Set whether iterating over std::map type containers yields (key, value) tuples
+// instead of std::pair proxies. Returns the previous setting.
+    PyObject* tuples = nullptr;
+    if (!PyArg_ParseTuple(args, const_cast<char*>("O"), &tuples))
+        return nullptr;
+
+    int istrue = PyObject_IsTrue(tuples);
+    if (istrue == -1)
+        return nullptr;
+
+    PyObject* old = CPyCppyy::SetMapIterTuplePolicy((bool)istrue) ? Py_True : Py_False;
+    Py_INCREF(old);
+    return old;
+}
+
+//----------------------------------------------------------------------------
+static PyObject* GetBindingsMemory(PyObject*, PyObject* pyclass)
+{
+// Report the (approximate) memory held by the method bindings of the given class or
+// namespace, as a dictionary with the number of methods and the number of bytes.
+    if (!CPPScope_Check(pyclass)) {
+        PyErr_SetString(PyExc_TypeError, "C++ class or namespace proxy expected");
+        return nullptr;
+    }
+
+    PyObject* dct = PyObject_GetAttr(pyclass, PyStrings::gDict);
+    PyObject* attrs = dct ? PyMapping_Values(dct) : nullptr;
+    Py_XDECREF(dct);
+    if (!attrs)
+        return nullptr;
+
+    size_t nmethods = 0, nbytes = 0;
+    for (Py_ssize_t i = 0; i < PyList_GET_SIZE(attrs); ++i) {
+        PyObject* attr = PyList_GET_ITEM(attrs, i);
+        if (CPPOverload_Check(attr))
+            nbytes += ((CPPOverload*)attr)->GetMemoryUsage(&nmethods);
+        else if (TemplateProxy_Check(attr)) {
+            const TP_TInfo_t& ti = ((TemplateProxy*)attr)->fTI;
+            nbytes += sizeof(TemplateProxy) + sizeof(TemplateInfo);
+            for (CPPOverload* ol : {ti->fNonTemplated, ti->fTemplated, ti->fLowPriority}) {
+                if (ol) nbytes += ol->GetMemoryUsage(&nmethods);
+            }
+        }
+    }
+    Py_DECREF(attrs);
+
+    return Py_BuildValue("{s:n,s:n}", "methods", (Py_ssize_t)nmethods, "bytes", (Py_ssize_t)nbytes);
+}
+
+//----------------------------------------------------------------------------
+static PyObject* SetIdentityTracking(PyObject*, PyObject* args)
+{
+// Enable or disable identity tracking (re-use of the existing proxy when the same C++
+// address is bound again) for objects of a class, or of all classes in a namespace.
+    PyObject* pyscope = nullptr; PyObject* track = nullptr;
+    if (!PyArg_ParseTuple(args, const_cast<char*>("OO"), &pyscope, &track))
+        return nullptr;
+
+    if (!CPPScope_Check(pyscope)) {
+        PyErr_SetString(PyExc_TypeError, "C++ class or namespace expected");
+        return nullptr;
+    }
+
+    int istrue = PyObject_IsTrue(track);
+    if (istrue == -1)
+        return nullptr;
+
+    MemoryRegulator::SetTrackingPolicy(((CPPScope*)pyscope)->fCppType, (bool)istrue);
+    Py_RETURN_NONE;
+}
+
+//----------------------------------------------------------------------------
+static PyObject* SetDeferredDestruction(PyObject*, PyObject* args)
+{
+// Select whether Python-owned objects of the given class are destroyed on a background
+// thread (without the GIL) rather than synchronously on release of the proxy.
+    PyObject* pyclass = nullptr; PyObject* defer = nullptr;
+    if (!PyArg_ParseTuple(args, const_cast<char*>("OO"), &pyclass, &defer))
+        return nullptr;
+
+    if (!CPPScope_Check(pyclass) || (((CPPScope*)pyclass)->fFlags &
+            (CPPScope::kIsNamespace | CPPScope::kIsPython))) {
+        PyErr_SetString(PyExc_TypeError, "C++ class expected");
+        return nullptr;
+    }
+
+    int istrue = PyObject_IsTrue(defer);
+    if (istrue == -1)
+        return nullptr;
+
+    if (istrue)
+        ((CPPScope*)pyclass)->fFlags |= CPPScope::kDeferDestruct;
+    else
+        ((CPPScope*)pyclass)->fFlags &= ~CPPScope::kDeferDestruct;
+    Py_RETURN_NONE;
+}
+
+//----------------------------------------------------------------------------
+static PyObject* FlushDeferredDestruction(PyObject*)
+{
+// Wait for all objects queued for deferred destruction to have been destroyed.
+    DestructionQueue::Flush();
+    Py_RETURN_NONE;
+}
+
+//----------------------------------------------------------------------------
+static PyObject* SetProxyFreeListLimit(PyObject*, PyObject* args)
+{
+// Set the maximum number of instance proxies kept for re-use per class; 0 disables.
+// Returns the previous limit.
+    PyObject* limit = nullptr;
+    if (!PyArg_ParseTuple(args, const_cast<char*>("O!"), &PyInt_Type, &limit))
+        return nullptr;
+
+    long l = PyInt_AsLong(limit);
+    if ((l == -1 && PyErr_Occurred()) || l < 0 || (long)UINT32_MAX < l) {
+        PyErr_Clear();
+        PyErr_Format(PyExc_ValueError, "limit should be between 0 and %lu", (unsigned long)UINT32_MAX);
+        return nullptr;
+    }
+
+    return PyLong_FromUnsignedLong(SetInstanceFreeListLimit((uint32_t)l));
+}
+
+//----------------------------------------------------------------------------
+static PyObject* GetProxyStats(PyObject*)
+{
+// Report the number of instance proxies allocated and recycled so far, and the limit.
+    size_t allocated = 0, reused = 0; uint32_t limit = 0;
+    GetInstanceFreeListStats(allocated, reused, limit);
+    return Py_BuildValue((char*)"{s:n,s:n,s:k}", "allocated", (Py_ssize_t)allocated,
+        "reused", (Py_ssize_t)reused, "limit", (unsigned long)limit);
+}
+
 //----------------------------------------------------------------------------
 static PyObject* SetOwnership(PyObject*, PyObject* args)
 {
@@ -951,6 +1121,24 @@ static PyMethodDef gCPyCppyyMethods[] = {
       METH_VARARGS, (char*)"Determines object ownership model."},
     {(char*) "SetGlobalSignalPolicy", (PyCFunction)SetGlobalSignalPolicy,
       METH_VARARGS, (char*)"Trap signals in safe mode to prevent interpreter abort."},
+    {(char*) "SetGILReleasePolicy", (PyCFunction)SetGILReleasePolicy,
+      METH_VARARGS, (char*)"Release the GIL for methods with a median call time (in us) above threshold."},
+    {(char*) "AddGILReleaseExclusion", (PyCFunction)AddGILReleaseExclusion,
+      METH_VARARGS, (char*)"Never release the GIL automatically for the named method."},
+    {(char*) "SetMapIterTuplePolicy", (PyCFunction)SetMapIterTuplePolicy,
+      METH_VARARGS, (char*)"Iterate over std::map type containers as (key, value) tuples."},
+    {(char*) "_get_bindings_memory", (PyCFunction)GetBindingsMemory,
+      METH_O, (char*)"Report the memory held by the method bindings of a class or namespace."},
+    {(char*) "SetIdentityTracking", (PyCFunction)SetIdentityTracking,
+      METH_VARARGS, (char*)"Enable or disable object identity tracking for a class or namespace."},
+    {(char*) "SetDeferredDestruction", (PyCFunction)SetDeferredDestruction,
+      METH_VARARGS, (char*)"Destroy Python-owned objects of a class on a background thread."},
+    {(char*) "FlushDeferredDestruction", (PyCFunction)FlushDeferredDestruction,
+      METH_NOARGS, (char*)"Wait for all deferred destructions to complete."},
+    {(char*) "SetProxyFreeListLimit", (PyCFunction)SetProxyFreeListLimit,
+      METH_VARARGS, (char*)"Set the number of instance proxies kept for re-use per class."},
+    {(char*) "_get_proxy_stats", (PyCFunction)GetProxyStats,
+      METH_NOARGS, (char*)"Report counts of allocated and recycled instance proxies."},
     {(char*) "SetOwnership", (PyCFunction)SetOwnership,
       METH_VARARGS, (char*)"Modify held C++ object ownership."},
     {(char*) "AddSmartPtrType", (PyCFunction)AddSmartPtrType,
@@ -1026,6 +1214,13 @@ extern "C" PyObject* PyInit_libcppyy()
 // keep gThisModule, but do not increase its reference count even as it is borrowed,
 // or a self-referencing cycle would be created
 
+// on free-threaded builds, the bindings' own state is synchronized (see Synchronization.h),
+// but declaring the GIL unneeded is opt-in, as the backend may not be safe for concurrent
+// use; without this declaration, PYTHON_GIL=0 can still be used to run without the GIL
+#if defined(Py_GIL_DISABLED) && defined(CPYCPPYY_GIL_NOT_USED)
+    PyUnstable_Module_SetGIL(gThisModule, Py_MOD_GIL_NOT_USED);
+#endif
+
 // external types
     gPyTypeMap = PyDict_New();
     PyModule_AddObject(gThisModule, "type_map", gPyTypeMap);    // steals reference
@@ -1079,6 +1274,9 @@ extern "C" PyObject* PyInit_libcppyy()
     if (PyType_Ready(&VectorIter_Type) < 0)
         return nullptr;
 
+    if (PyType_Ready(&AssocIter_Type) < 0)
+        return nullptr;
+
 // inject identifiable nullptr and default
     gNullPtrObject = (PyObject*)&_CPyCppyy_NullPtrStruct;
     Py_INCREF(gNullPtrObject);
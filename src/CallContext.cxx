@@ -2,6 +2,11 @@
 #include "CPyCppyy.h"
 #include "CallContext.h"
 
+// Standard
+#include <new>
+#include <set>
+#include <string.h>
+
 
 //- data _____________________________________________________________________
 namespace CPyCppyy {
@@ -10,31 +15,164 @@ namespace CPyCppyy {
 // this is just a data holder for linking; actual value is set in CPyCppyyModule.cxx
     CallContext::ECallFlags CallContext::sSignalPolicy = CallContext::kNone;
 
+    SharedFlags_t CallContext::sGILReleaseThreshold{0};
+    SharedFlags_t CallContext::sGILReleaseEpoch{0};
+    static std::set<std::string> gGILReleaseExclusions;
+    static Mutex gGILReleaseExclusionsMutex;
+
+} // namespace CPyCppyy
+
+//- call arena ---------------------------------------------------------------
+// size of the (reused) chunks of the per-thread arena; larger requests get their own
+#ifndef CPYCPPYY_CALLARENA_CHUNKSIZE
+#define CPYCPPYY_CALLARENA_CHUNKSIZE 16384
+#endif
+
+namespace CPyCppyy {
+
+class CallArena {
+public:
+    CallArena() : fCurrent(0), fOffset(0), fUsers(0) {}
+    CallArena(const CallArena&) = delete;
+    CallArena& operator=(const CallArena&) = delete;
+    ~CallArena() {
+        for (auto& c : fChunks)
+            ::operator delete(c.fData);
+    }
+
+// arena of the current thread
+    static CallArena* Get() {
+        static thread_local CallArena arena;
+        return &arena;
+    }
+
+    CallArenaMark Top() const { return {fCurrent, fOffset}; }
+
+    void* Allocate(size_t sz) {
+        sz = (sz + kAlign-1) & ~(size_t)(kAlign-1);
+        while (fCurrent < fChunks.size()) {
+            Chunk& c = fChunks[fCurrent];
+            if (fOffset + sz <= c.fSize) {
+                void* p = c.fData + fOffset;
+                fOffset += (uint32_t)sz;
+                return p;
+            }
+            fCurrent += 1; fOffset = 0;
+        }
+
+        size_t csz = sz < CPYCPPYY_CALLARENA_CHUNKSIZE ? CPYCPPYY_CALLARENA_CHUNKSIZE : sz;
+        fChunks.push_back({(char*)::operator new(csz), csz});
+        fCurrent = (uint32_t)fChunks.size()-1;
+        fOffset = (uint32_t)sz;
+        return fChunks.back().fData;
+    }
+
+// drop everything allocated since mark
+    void Release(const CallArenaMark& mark) {
+        fCurrent = mark.fChunk;
+        fOffset = mark.fOffset;
+    }
+
+// all memory is reclaimed once the last user is done, also if users did not finish
+// in order (e.g. because of greenlet switches); oversized chunks are not kept
+    void AddUser() { fUsers += 1; }
+    void RemoveUser() {
+        if (--fUsers == 0) {
+            while (!fChunks.empty() && CPYCPPYY_CALLARENA_CHUNKSIZE < fChunks.back().fSize) {
+                ::operator delete(fChunks.back().fData);
+                fChunks.pop_back();
+            }
+            Release({0, 0});
+        }
+    }
+
+private:
+    static const size_t kAlign = 16;
+
+    struct Chunk {
+        char*  fData;
+        size_t fSize;
+    };
+
+    std::vector<Chunk> fChunks;
+    uint32_t fCurrent;
+    uint32_t fOffset;
+    int      fUsers;
+};
+
+static inline bool operator==(const CallArenaMark& a, const CallArenaMark& b)
+{
+    return a.fChunk == b.fChunk && a.fOffset == b.fOffset;
+}
+
 } // namespace CPyCppyy
 
+//-----------------------------------------------------------------------------
+void* CPyCppyy::CallContext::Allocate(size_t sz)
+{
+    if (!fArena) {
+    // an asynchronous call outlives the dispatch and is finished on another thread, so
+    // gets an arena of its own
+        fArena = (fFlags & kAsyncCall) ? new CallArena{} : CallArena::Get();
+        fArena->AddUser();
+        fArenaBase = fArena->Top();
+        fArenaTop = fArenaBase;
+    } else if (!(fArena->Top() == fArenaTop)) {
+    // another context allocated in between and may still be alive: no early release
+        fArenaBase = {(uint32_t)-1, 0};
+    }
+
+    void* p = fArena->Allocate(sz);
+    fArenaTop = fArena->Top();
+    return p;
+}
+
+//-----------------------------------------------------------------------------
+void CPyCppyy::CallContext::ReleaseArena()
+{
+    if (fArena == CallArena::Get()) {
+        if (fArenaBase.fChunk != (uint32_t)-1 && fArena->Top() == fArenaTop)
+            fArena->Release(fArenaBase);
+        fArena->RemoveUser();
+    } else
+        delete fArena;
+    fArena = nullptr;
+}
+
+//-----------------------------------------------------------------------------
+void CPyCppyy::CallContext::GrowArgs()
+{
+// previously set arguments are kept, new ones are zeroed, as for a vector resize
+    Parameter* args = (Parameter*)Allocate(fNArgs*sizeof(Parameter));
+    if (fArgsCap)
+        memcpy((void*)args, (void*)fArgsBuf, fArgsCap*sizeof(Parameter));
+    memset((void*)(args+fArgsCap), 0, (fNArgs-fArgsCap)*sizeof(Parameter));
+    fArgsBuf = args;
+    fArgsCap = fNArgs;
+}
+
 //-----------------------------------------------------------------------------
 void CPyCppyy::CallContext::AddTemporary(PyObject* pyobj) {
     if (pyobj) {
+        Temporary* tmp = new (Allocate(sizeof(Temporary))) Temporary{pyobj, nullptr};
         if (!fTemps)
-            fTemps = new Temporary{pyobj, nullptr};
-        else {
-            Temporary* tmp = fTemps;
-            while (tmp->fNext) tmp = tmp->fNext;
-            tmp->fNext = new Temporary{pyobj, nullptr};
-        }
+            fTemps = tmp;
+        else
+            fTempsLast->fNext = tmp;
+        fTempsLast = tmp;
     }
 }
 
 //-----------------------------------------------------------------------------
 void CPyCppyy::CallContext::Cleanup() {
+// the nodes themselves are reclaimed with the arena
     Temporary* tmp = fTemps;
     while (tmp) {
         Py_DECREF(tmp->fPyObject);
-        Temporary* tmp2 = tmp->fNext;
-        delete tmp;
-        tmp = tmp2;
+        tmp = tmp->fNext;
     }
     fTemps = nullptr;
+    fTempsLast = nullptr;
 }
 
 //-----------------------------------------------------------------------------
@@ -59,3 +197,33 @@ bool CPyCppyy::CallContext::SetGlobalSignalPolicy(bool setProtected)
     return old;
 }
 
+
+//-----------------------------------------------------------------------------
+uint32_t CPyCppyy::CallContext::SetGILReleasePolicy(uint32_t threshold)
+{
+// Set the median call duration (in microseconds) above which methods release the
+// GIL automatically; 0 disables. Returns the previous threshold.
+    uint32_t old = sGILReleaseThreshold;
+    sGILReleaseThreshold = threshold;
+    sGILReleaseEpoch += 1;
+    return old;
+}
+
+//-----------------------------------------------------------------------------
+void CPyCppyy::CallContext::AddGILReleaseExclusion(const std::string& name)
+{
+// Never release the GIL automatically for the method with the given scoped name
+// (e.g. because it calls back into Python).
+    {
+        LockGuard lock(gGILReleaseExclusionsMutex);
+        gGILReleaseExclusions.insert(name);
+    }
+    sGILReleaseEpoch += 1;
+}
+
+//-----------------------------------------------------------------------------
+bool CPyCppyy::CallContext::IsGILReleaseExcluded(const std::string& name)
+{
+    LockGuard lock(gGILReleaseExclusionsMutex);
+    return gGILReleaseExclusions.find(name) != gGILReleaseExclusions.end();
+}
@@ -3,19 +3,31 @@
 
 #include "Python.h"
 #include "Cppyy.h"
+#include "Synchronization.h"
 
 // Standard
-#include <vector>
 #include <cstdint>
+#include <string>
+#include <vector>
 
 #include <sys/types.h>
 
 
 namespace CPyCppyy {
 
+class AsyncCall;
+
 // small number that allows use of stack for argument passing
 const int SMALL_ARGS_N = 8;
 
+// outcome of a side-effect free check of arguments, used for overload selection
+enum EArgMatch {
+    kNoMatch       = 0,    // conversion will fail
+    kImplicitMatch = 1,    // conversion can only succeed if implicit conversions are allowed
+    kMaybeMatch    = 2,    // undecided: only an actual conversion can tell
+    kExactMatch    = 3     // Python type matches the C++ type
+};
+
 // convention to pass flag for direct calls (similar to Python's vector calls)
 #define DIRECT_CALL ((size_t)1 << (8 * sizeof(size_t) - 1))
 
@@ -48,13 +60,22 @@ struct Parameter {
 };
 #endif // CPYCPPYY_PARAMETER
 
+// per-thread bump allocator for memory that lives for the duration of a call
+class CallArena;
+
+struct CallArenaMark {
+    uint32_t fChunk;
+    uint32_t fOffset;
+};
+
 // extra call information
 struct CallContext {
     CallContext() : fCurScope(nullptr), fPyContext(nullptr), fFlags(0),
-        fArgsVec(nullptr), fNArgs(0), fTemps(nullptr) {}
+        fFailReason(kFailNone), fAsync(nullptr), fArgsBuf(nullptr), fArgsCap(0),
+        fNArgs(0), fTemps(nullptr), fTempsLast(nullptr), fArena(nullptr) {}
     CallContext(const CallContext&) = delete;
     CallContext& operator=(const CallContext&) = delete;
-    ~CallContext() { if (fTemps) Cleanup(); delete fArgsVec; }
+    ~CallContext() { if (fTemps) Cleanup(); if (fArena) ReleaseArena(); }
 
     enum ECallFlags {
         kNone                        = 0x000000,
@@ -74,9 +95,21 @@ struct CallContext {
         kPyException                 = 0x002000, // Python exception during method execution
         kCppException                = 0x004000, // C++ exception during method execution
         kProtected                   = 0x008000, // if method should return on signals
-        kUseFFI                      = 0x010000, // not implemented
+        kUseFFI                      = 0x010000, // call through function address if possible
         kIsPseudoFunc                = 0x020000, // internal, used for introspection
         kUseStrict                   = 0x040000, // if method applies strict memory policy
+        kDeferErrors                 = 0x080000, // record argument failures, instead of raising
+        kAsyncCall                   = 0x100000, // capture the converted call for fAsync
+        kKeepGIL                     = 0x200000, // never release the GIL automatically
+        kConvertOnly                 = 0x400000, // convert the arguments, but never execute
+    };
+
+// reasons for a failed call recorded under kDeferErrors
+    enum EFailReason {
+        kFailNone                    = 0,
+        kFailNoMatch                 = 1,        // rejected by the argument pre-check
+        kFailArgCount                = 2,        // wrong number of arguments
+        kFailConversion              = 3         // an argument could not be converted
     };
 
 // memory handling
@@ -86,21 +119,30 @@ struct CallContext {
     void AddTemporary(PyObject* pyobj);
     void Cleanup();
 
+// scratch memory (16-byte aligned) that remains valid until the context is destroyed
+    void* Allocate(size_t sz);
+
 // signal safety
     static ECallFlags sSignalPolicy;
     static bool SetGlobalSignalPolicy(bool setProtected);
 
+// automatic GIL release for methods that are measured to be long running (opt-in)
+    static SharedFlags_t sGILReleaseThreshold;   // median call time in microseconds, 0 if off
+    static SharedFlags_t sGILReleaseEpoch;       // changes on updates to force re-sampling
+    static uint32_t SetGILReleasePolicy(uint32_t threshold);
+    static void AddGILReleaseExclusion(const std::string& name);
+    static bool IsGILReleaseExcluded(const std::string& name);
+
     Parameter* GetArgs(size_t sz) {
         if (sz != (size_t)-1) fNArgs = sz;
         if (fNArgs <= SMALL_ARGS_N) return fArgs;
-        if (!fArgsVec) fArgsVec = new std::vector<Parameter>();
-        fArgsVec->resize(fNArgs);
-        return fArgsVec->data();
+        if (fArgsCap < fNArgs) GrowArgs();
+        return fArgsBuf;
     }
 
     Parameter* GetArgs() {
         if (fNArgs <= SMALL_ARGS_N) return fArgs;
-        return fArgsVec->data();
+        return fArgsBuf;
     }
 
     size_t GetSize() { return fNArgs; }
@@ -112,14 +154,30 @@ public:
     PyObject*          fPyContext;
     uint32_t           fFlags;
 
+// deferred diagnostics (see kDeferErrors)
+    uint16_t           fFailReason;
+
+// receiver of the captured call (see kAsyncCall)
+    AsyncCall*         fAsync;
+
 private:
     struct Temporary { PyObject* fPyObject; Temporary* fNext; };
 
-// payload
+    void GrowArgs();
+    void ReleaseArena();
+
+// payload; arguments beyond SMALL_ARGS_N and the temporaries live in the arena
     Parameter               fArgs[SMALL_ARGS_N];
-    std::vector<Parameter>* fArgsVec;
+    Parameter*              fArgsBuf;
+    size_t                  fArgsCap;
     size_t                  fNArgs;
     Temporary*              fTemps;
+    Temporary*              fTempsLast;
+
+// arena in use, if any, with its top at first use, and after the last allocation
+    CallArena*              fArena;
+    CallArenaMark           fArenaBase;
+    CallArenaMark           fArenaTop;
 };
 
 inline bool IsSorted(uint64_t flags) {
@@ -146,6 +204,10 @@ inline bool NoImplicit(CallContext* ctxt) {
     return ctxt ? (ctxt->fFlags & CallContext::kNoImplicit) : false;
 }
 
+inline bool DeferErrors(CallContext* ctxt) {
+    return ctxt ? (ctxt->fFlags & CallContext::kDeferErrors) : false;
+}
+
 inline bool ReleasesGIL(CallContext* ctxt) {
     return ctxt ? (ctxt->fFlags & CallContext::kReleaseGIL) : false;
 }
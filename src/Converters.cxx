@@ -11,6 +11,7 @@
 #include "MemoryRegulator.h"
 #include "ProxyWrappers.h"
 #include "PyStrings.h"
+#include "Synchronization.h"
 #include "TemplateProxy.h"
 #include "TupleOfInstances.h"
 #include "TypeManip.h"
@@ -24,12 +25,14 @@
 #include <string.h>
 #include <algorithm>
 #include <array>
+#include <limits>
 #include <locale>        // for wstring_convert
 #include <regex>
 #include <utility>
 #include <sstream>
 #include <cstddef>
 #include <string_view>
+#include <typeinfo>
 #if __cplusplus >= 202002L
 #include <span>
 #endif
@@ -40,7 +43,7 @@ namespace CPyCppyy {
 
 // factories
     typedef std::unordered_map<std::string, cf_t> ConvFactories_t;
-    static ConvFactories_t gConvFactories;
+    static RCUTable<ConvFactories_t> gConvFactories;
 
 // special objects
     extern PyObject* gNullPtrObject;
@@ -354,6 +357,46 @@ static inline bool StrictBool(PyObject* pyobject, CPyCppyy::CallContext* ctxt)
     return true;
 }
 
+// side-effect free equivalents of the checks done on conversion (see Converter::ArgMatch)
+static inline int IntegerArgMatch(PyObject* pyobject)
+{
+    using namespace CPyCppyy;
+    if (PyBool_Check(pyobject))
+        return kImplicitMatch;
+    if (PyLong_Check(pyobject))
+        return kExactMatch;
+    if (PyFloat_Check(pyobject) || CPyCppyy_PyText_Check(pyobject) ||
+            PyBytes_Check(pyobject) || pyobject == Py_None)
+        return kNoMatch;
+    return kMaybeMatch;        // e.g. ctypes types or objects with __index__
+}
+
+static inline int FloatArgMatch(PyObject* pyobject)
+{
+    using namespace CPyCppyy;
+    if (PyFloat_Check(pyobject))
+        return kExactMatch;
+// (subclasses of str and bytes may implement __float__)
+    if (PyBool_Check(pyobject) || PyUnicode_CheckExact(pyobject) ||
+            PyBytes_CheckExact(pyobject) || pyobject == Py_None)
+        return kNoMatch;
+    return kMaybeMatch;        // int -> float is accepted, but not exact
+}
+
+static inline int CharArgMatch(PyObject* pyobject)
+{
+    using namespace CPyCppyy;
+    if (PyFloat_Check(pyobject) || pyobject == Py_None)
+        return kNoMatch;
+    return kMaybeMatch;        // size and range checks need the actual conversion
+}
+
+static inline int UnicodeArgMatch(PyObject* pyobject)
+{
+    using namespace CPyCppyy;
+    return PyUnicode_Check(pyobject) ? kMaybeMatch : kNoMatch;
+}
+
 static inline bool CPyCppyy_PyLong_AsBool(PyObject* pyobject)
 {
 // range-checking python integer to C++ bool conversion
@@ -593,6 +636,11 @@ bool CPyCppyy::name##Converter::SetArg(                                      \
     if (!StrictBool(pyobject, ctxt))                                         \
         return false;                                                        \
     CPPYY_IMPL_BASIC_CONVERTER_BODY(name, type, stype, ctype, F1, F2, tc)    \
+}                                                                            \
+                                                                             \
+int CPyCppyy::name##Converter::ArgMatch(PyObject* pyobject)                  \
+{                                                                            \
+    return PyBool_Check(pyobject) ? kExactMatch : kImplicitMatch;            \
 }                                                                            \
 CPPYY_IMPL_BASIC_CONVERTER_METHODS(name, type, stype, ctype, F1, F2)
 
@@ -603,6 +651,11 @@ bool CPyCppyy::name##Converter::SetArg(                                      \
     if (!ImplicitBool(pyobject, ctxt))                                       \
         return false;                                                        \
     CPPYY_IMPL_BASIC_CONVERTER_BODY(name, type, stype, ctype, F1, F2, tc)    \
+}                                                                            \
+                                                                             \
+int CPyCppyy::name##Converter::ArgMatch(PyObject* pyobject)                  \
+{                                                                            \
+    return IntegerArgMatch(pyobject);                                        \
 }                                                                            \
 CPPYY_IMPL_BASIC_CONVERTER_METHODS(name, type, stype, ctype, F1, F2)
 
@@ -613,6 +666,11 @@ bool CPyCppyy::name##Converter::SetArg(                                      \
     if (PyBool_Check(pyobject))                                              \
         return false;                                                        \
     CPPYY_IMPL_BASIC_CONVERTER_BODY(name, type, stype, ctype, F1, F2, tc)    \
+}                                                                            \
+                                                                             \
+int CPyCppyy::name##Converter::ArgMatch(PyObject* pyobject)                  \
+{                                                                            \
+    return FloatArgMatch(pyobject);                                          \
 }                                                                            \
 CPPYY_IMPL_BASIC_CONVERTER_METHODS(name, type, stype, ctype, F1, F2)
 
@@ -715,6 +773,11 @@ bool CPyCppyy::name##Converter::SetArg(                                      \
     return true;                                                             \
 }                                                                            \
                                                                              \
+int CPyCppyy::name##Converter::ArgMatch(PyObject* pyobject)                  \
+{                                                                            \
+    return CharArgMatch(pyobject);                                           \
+}                                                                            \
+                                                                             \
 PyObject* CPyCppyy::name##Converter::FromMemory(void* address)               \
 {                                                                            \
     /* return char in "native" str type as that's more natural in use */     \
@@ -904,6 +967,11 @@ bool CPyCppyy::WCharConverter::SetArg(
     return true;
 }
 
+int CPyCppyy::WCharConverter::ArgMatch(PyObject* pyobject)
+{
+    return UnicodeArgMatch(pyobject);
+}
+
 PyObject* CPyCppyy::WCharConverter::FromMemory(void* address)
 {
     return PyUnicode_FromWideChar((const wchar_t*)address, 1);
@@ -943,6 +1011,11 @@ bool CPyCppyy::Char16Converter::SetArg(
     return true;
 }
 
+int CPyCppyy::Char16Converter::ArgMatch(PyObject* pyobject)
+{
+    return UnicodeArgMatch(pyobject);
+}
+
 PyObject* CPyCppyy::Char16Converter::FromMemory(void* address)
 {
     return PyUnicode_DecodeUTF16((const char*)address, sizeof(char16_t), nullptr, nullptr);
@@ -983,6 +1056,11 @@ bool CPyCppyy::Char32Converter::SetArg(
     return true;
 }
 
+int CPyCppyy::Char32Converter::ArgMatch(PyObject* pyobject)
+{
+    return UnicodeArgMatch(pyobject);
+}
+
 PyObject* CPyCppyy::Char32Converter::FromMemory(void* address)
 {
     return PyUnicode_DecodeUTF32((const char*)address, sizeof(char32_t), nullptr, nullptr);
@@ -1030,6 +1108,11 @@ bool CPyCppyy::ULongConverter::SetArg(
     return true;
 }
 
+int CPyCppyy::ULongConverter::ArgMatch(PyObject* pyobject)
+{
+    return IntegerArgMatch(pyobject);
+}
+
 PyObject* CPyCppyy::ULongConverter::FromMemory(void* address)
 {
 // construct python object from C++ unsigned long read at <address>
@@ -1171,6 +1254,11 @@ bool CPyCppyy::LLongConverter::SetArg(
     return true;
 }
 
+int CPyCppyy::LLongConverter::ArgMatch(PyObject* pyobject)
+{
+    return IntegerArgMatch(pyobject);
+}
+
 PyObject* CPyCppyy::LLongConverter::FromMemory(void* address)
 {
 // construct python object from C++ long long read at <address>
@@ -1207,6 +1295,11 @@ bool CPyCppyy::ULLongConverter::SetArg(
     return true;
 }
 
+int CPyCppyy::ULLongConverter::ArgMatch(PyObject* pyobject)
+{
+    return IntegerArgMatch(pyobject);
+}
+
 PyObject* CPyCppyy::ULLongConverter::FromMemory(void* address)
 {
 // construct python object from C++ unsigned long long read at <address>
@@ -2322,6 +2415,18 @@ bool CPyCppyy::InstanceRefConverter::SetArg(
     return (bool)ConvertImplicit(fClass, pyobject, para, ctxt);
 }
 
+//----------------------------------------------------------------------------
+int CPyCppyy::InstanceRefConverter::ArgMatch(PyObject* pyobject)
+{
+// builtin Python types can only ever reach a C++ instance through a converting
+// constructor, which is not available for non-const references
+    PyTypeObject* pytype = Py_TYPE(pyobject);
+    if (pytype == &PyLong_Type || pytype == &PyFloat_Type || pytype == &PyBool_Type ||
+            pytype == &PyUnicode_Type || pytype == &PyBytes_Type || pyobject == Py_None)
+        return fIsConst ? kImplicitMatch : kNoMatch;
+    return kMaybeMatch;
+}
+
 //----------------------------------------------------------------------------
 PyObject* CPyCppyy::InstanceRefConverter::FromMemory(void* address)
 {
@@ -2588,6 +2693,12 @@ bool CPyCppyy::PyObjectConverter::SetArg(
     return true;
 }
 
+int CPyCppyy::PyObjectConverter::ArgMatch(PyObject*)
+{
+// by definition: any object is accepted
+    return kExactMatch;
+}
+
 PyObject* CPyCppyy::PyObjectConverter::FromMemory(void* address)
 {
 // construct python object from C++ PyObject* read at <address>
@@ -3033,6 +3144,28 @@ struct faux_initlist
 #define NO_KNOWN_INITIALIZER_LIST 1
 #endif
 
+#ifndef NO_KNOWN_INITIALIZER_LIST
+static inline size_t InitListSize(faux_initlist* fake, size_t valsize)
+{
+#if defined (_LIBCPP_INITIALIZER_LIST) || defined(__GNUC__)
+    (void)valsize;
+    return (size_t)fake->_M_len;
+#elif defined (_MSC_VER)
+    return (size_t)(fake->_Last - fake->_M_array)/valsize;
+#endif
+}
+
+static inline void SetInitListSize(faux_initlist* fake, size_t len, size_t valsize)
+{
+#if defined (_LIBCPP_INITIALIZER_LIST) || defined(__GNUC__)
+    (void)valsize;
+    fake->_M_len = (faux_initlist::size_type)len;
+#elif defined (_MSC_VER)
+    fake->_Last = fake->_M_array+len*valsize;
+#endif
+}
+#endif
+
 } // unnamed namespace
 
 CPyCppyy::InitializerListConverter::InitializerListConverter(Cppyy::TCppScope_t klass, std::string const &value_type)
@@ -3046,27 +3179,51 @@ CPyCppyy::InitializerListConverter::InitializerListConverter(Cppyy::TCppScope_t
 
 CPyCppyy::InitializerListConverter::~InitializerListConverter()
 {
-    for (Converter *converter : fConverters) {
-       if (converter && converter->HasState()) delete converter;
-    }
+    if (fElementConverter && fElementConverter->HasState()) delete fElementConverter;
     if (fBuffer) Clear();
 }
 
 void CPyCppyy::InitializerListConverter::Clear() {
-    if (fValueType) {
+#ifndef NO_KNOWN_INITIALIZER_LIST
+    if (fValueType && fDestruct) {
         faux_initlist* fake = (faux_initlist*)fBuffer;
-#if defined (_LIBCPP_INITIALIZER_LIST) || defined(__GNUC__)
-        for (faux_initlist::size_type i = 0; i < fake->_M_len; ++i) {
-#elif defined (_MSC_VER)
-        for (size_t i = 0; (fake->_M_array+i*fValueSize) != fake->_Last; ++i) {
-#endif
+        for (size_t i = 0; i < InitListSize(fake, fValueSize); ++i) {
             void* memloc = (char*)fake->_M_array + i*fValueSize;
             Cppyy::CallDestructor(fValueType, (Cppyy::TCppObject_t)memloc);
         }
     }
+#endif
 
     free(fBuffer);
     fBuffer = nullptr;
+    fDestruct = false;
+}
+
+CPyCppyy::Converter* CPyCppyy::InitializerListConverter::GetElementConverter()
+{
+// the converter for the elements is shared by all elements and calls
+    if (!fHasElementConverter) {
+        fElementConverter = CreateConverter(fValueTypeName);
+        fHasElementConverter = true;
+    }
+    return fElementConverter;
+}
+
+bool CPyCppyy::InitializerListConverter::IsBulkCopyable(PyObject** items, Py_ssize_t len)
+{
+// objects of the value type itself that are trivially copyable, can be byte-copied
+    if (!fValueType || !len)
+        return false;
+
+    for (Py_ssize_t i = 0; i < len; ++i) {
+        if (!CPPInstance_Check(items[i]))
+            return false;
+        CPPInstance* pyobj = (CPPInstance*)items[i];
+        if (pyobj->ObjectIsA() != fValueType || !pyobj->GetObject())
+            return false;
+    }
+
+    return Utility::IsTriviallyCopyable(fValueType);
 }
 
 bool CPyCppyy::InitializerListConverter::SetArg(
@@ -3090,17 +3247,12 @@ bool CPyCppyy::InitializerListConverter::SetArg(
     void* buf = nullptr;
     Py_ssize_t buflen = Utility::GetBuffer(pyobject, '*', (int)fValueSize, buf, true);
     faux_initlist* fake = nullptr;
-    size_t entries = 0;
     if (buf && buflen) {
     // dealing with an array here, pass on whole-sale
         fake = (faux_initlist*)malloc(sizeof(faux_initlist));
         fBuffer = (void*)fake;
         fake->_M_array = (faux_initlist::iterator)buf;
-#if defined (_LIBCPP_INITIALIZER_LIST) || defined(__GNUC__)
-        fake->_M_len = (faux_initlist::size_type)buflen;
-#elif defined (_MSC_VER)
-        fake->_Last = fake->_M_array+buflen*fValueSize;
-#endif
+        SetInitListSize(fake, (size_t)buflen, fValueSize);
     } else if (fValueSize) {
     // Remove any errors set by GetBuffer(); note that if the argument was an array
     // that failed to extract because of a type mismatch, the following will perform
@@ -3108,67 +3260,75 @@ bool CPyCppyy::InitializerListConverter::SetArg(
     // so either.
         PyErr_Clear();
 
+        PyObject* seq = PySequence_Fast(pyobject, "initializer list requires a sequence");
+        if (!seq)
+            return false;
+        Py_ssize_t len = PySequence_Fast_GET_SIZE(seq);
+        PyObject** items = PySequence_Fast_ITEMS(seq);
+
+        fake = (faux_initlist*)malloc(sizeof(faux_initlist)+fValueSize*len);
+        fBuffer = (void*)fake;
+        fake->_M_array = (faux_initlist::iterator)((char*)fake+sizeof(faux_initlist));
+        SetInitListSize(fake, (size_t)len, fValueSize);
+
+        if (IsBulkCopyable(items, len)) {
+        // no construction (or destruction) needed, byte copies will do
+            for (Py_ssize_t i = 0; i < len; ++i) {
+                memcpy((char*)fake->_M_array + i*fValueSize,
+                       ((CPPInstance*)items[i])->GetObject(), fValueSize);
+            }
+            Py_DECREF(seq);
+            para.fValue.fVoidp = (void*)fake;
+            para.fTypeCode = 'V';
+            return true;
+        }
+
     // Can only construct empty lists, so use a fake initializer list. For that we
     // need to construct default objects. Fail early if that cannot work.
         if (fValueType && !Cppyy::IsDefaultConstructable(fValueType)) {
             PyErr_SetString(PyExc_TypeError, "default constructor needed for initializer list of objects");
+            Py_DECREF(seq);
+            Clear();
             return false;
         }
 
-        size_t len = (size_t)PySequence_Size(pyobject);
-        fake = (faux_initlist*)malloc(sizeof(faux_initlist)+fValueSize*len);
-        fBuffer = (void*)fake;
-        fake->_M_array = (faux_initlist::iterator)((char*)fake+sizeof(faux_initlist));
-#if defined (_LIBCPP_INITIALIZER_LIST) || defined(__GNUC__)
-        fake->_M_len = (faux_initlist::size_type)len;
-        for (faux_initlist::size_type i = 0; i < fake->_M_len; ++i) {
-#elif defined (_MSC_VER)
-        fake->_Last = fake->_M_array+len*fValueSize;
-        for (size_t i = 0; (fake->_M_array+i*fValueSize) != fake->_Last; ++i) {
-#endif
-            PyObject* item = PySequence_GetItem(pyobject, i);
+        Converter* converter = GetElementConverter();
+        fDestruct = true;
+        size_t entries = 0;
+        for (Py_ssize_t i = 0; i < len; ++i) {
+            PyObject* item = items[i];
             bool convert_ok = false;
-            if (item) {
-                Converter *converter = CreateConverter(fValueTypeName);
-                if (!converter) {
-                    if (CPPInstance_Check(item)) {
-                    // by convention, use byte copy
-                        memcpy((char*)fake->_M_array + i*fValueSize,
-                               ((CPPInstance*)item)->GetObject(), fValueSize);
-                        convert_ok = true;
-                    }
-                } else {
-                    void* memloc = (char*)fake->_M_array + i*fValueSize;
-                    if (fValueType) {
-                    // we need to construct a default object for the constructor to assign into; this is
-                    // clunky, but the use of a copy constructor isn't much better as the Python object
-                    // need not be a C++ object
-                        memloc = (void*)Cppyy::Construct(fValueType, memloc).data;
-                    // We checked above that we are able to construct default objects of fValueType.
-                        assert(memloc && ("failed to default construct object for type " + fValueTypeName).c_str());
-                        entries += 1;
-                    }
-                    if (memloc) {
-                        convert_ok = converter->ToMemory(item, memloc);
-                    }
-                    fConverters.emplace_back(converter);
+            if (!converter) {
+                if (CPPInstance_Check(item)) {
+                // by convention, use byte copy
+                    memcpy((char*)fake->_M_array + i*fValueSize,
+                           ((CPPInstance*)item)->GetObject(), fValueSize);
+                    convert_ok = true;
                 }
-
-
-                Py_DECREF(item);
-            } else
-                PyErr_Format(PyExc_TypeError, "failed to get item %d from sequence", (int)i);
+            } else {
+                void* memloc = (char*)fake->_M_array + i*fValueSize;
+                if (fValueType) {
+                // we need to construct a default object for the constructor to assign into; this is
+                // clunky, but the use of a copy constructor isn't much better as the Python object
+                // need not be a C++ object
+                    memloc = (void*)Cppyy::Construct(fValueType, memloc).data;
+                // We checked above that we are able to construct default objects of fValueType.
+                    assert(memloc && ("failed to default construct object for type " + fValueTypeName).c_str());
+                    entries += 1;
+                }
+                if (memloc) {
+                    convert_ok = converter->ToMemory(item, memloc);
+                }
+            }
 
             if (!convert_ok) {
-#if defined (_LIBCPP_INITIALIZER_LIST) || defined(__GNUC__)
-                fake->_M_len = (faux_initlist::size_type)entries;
-#elif defined (_MSC_VER)
-                fake->_Last = fake->_M_array+entries*fValueSize;
-#endif
+                SetInitListSize(fake, entries, fValueSize);
+                Py_DECREF(seq);
                 Clear();
                 return false;
             }
         }
+        Py_DECREF(seq);
     }
 
     if (!fake)     // no buffer and value size indeterminate
@@ -3230,6 +3390,84 @@ static inline CPyCppyy::Converter* selectInstanceCnv(Cppyy::TCppScope_t klass,
     return result;
 }
 
+static inline CPyCppyy::Converter* selectSmartPtrCnv(Cppyy::TCppScope_t klass,
+        Cppyy::TCppScope_t raw, const std::string& cpd, CPyCppyy::cdims_t dims, bool control)
+{
+    using namespace CPyCppyy;
+    Converter* result = nullptr;
+
+    if (cpd == "")
+        result = new SmartPtrConverter(klass, raw, control);
+    else if (cpd == "&")
+        result = new SmartPtrConverter(klass, raw);
+    else if (cpd == "*" && dims.ndim() == UNKNOWN_SIZE)
+        result = new SmartPtrConverter(klass, raw, control, true);
+
+    return result;
+}
+
+//- type-keyed cache ---------------------------------------------------------
+namespace {
+
+using namespace CPyCppyy;
+
+// outcome of the (string-based) resolution of a type to a converter, to be replayed
+// for later requests with the same type and dimensions: either a factory and the
+// dimensions to call it with, a shared converter, or the parameters of a converter
+// for a known class; outcomes that may change once more C++ is loaded, such as the
+// fallbacks for unknown types, are not recorded
+struct ConvRecipe {
+    enum EKind { kNone, kFactory, kShared, kInstance, kSmartPtr };
+
+    ConvRecipe() : fKind(kNone), fFactory(nullptr), fShared(nullptr),
+        fIsConst(false), fControl(false) {}
+
+    Converter* Factory(cf_t f, cdims_t dims) {
+        fKind = kFactory; fFactory = f; fDims = dims;
+        return f(fDims);
+    }
+
+    Converter* Replay() const {
+        switch (fKind) {
+        case kFactory:  return fFactory(fDims);
+        case kShared:   return fShared;
+        case kInstance: return selectInstanceCnv(fClass, fCpd, fDims, fIsConst, fControl);
+        case kSmartPtr: return selectSmartPtrCnv(fClass, fRaw, fCpd, fDims, fControl);
+        default:        return nullptr;
+        }
+    }
+
+    EKind              fKind;
+    cf_t               fFactory;
+    Converter*         fShared;
+    dims_t             fDims;
+    Cppyy::TCppScope_t fClass;
+    Cppyy::TCppScope_t fRaw;
+    std::string        fCpd;
+    bool               fIsConst;
+    bool               fControl;
+};
+
+typedef std::pair<Cppyy::TCppType_t, dims_t> ConvCacheKey_t;
+struct ConvCacheHash {
+    size_t operator()(const ConvCacheKey_t& key) const {
+        return std::hash<Cppyy::TCppType_t>{}(key.first) ^ key.second.hash();
+    }
+};
+
+typedef std::unordered_map<ConvCacheKey_t, ConvRecipe, ConvCacheHash> ConvCache_t;
+static ConvCache_t gConvCache;
+static Mutex gConvCacheMutex;
+
+// registered factories change the outcome of resolutions
+static inline void ClearConvCache()
+{
+    LockGuard lock(gConvCacheMutex);
+    gConvCache.clear();
+}
+
+} // unnamed namespace
+
 //- factories ----------------------------------------------------------------
 CPYCPPYY_EXPORT
 CPyCppyy::Converter* CPyCppyy::CreateConverter(const std::string& fullType, cdims_t dims)
@@ -3244,8 +3482,9 @@ CPyCppyy::Converter* CPyCppyy::CreateConverter(const std::string& fullType, cdim
 // If all fails, void is used, which will generate a run-time warning when used.
 
 // an exactly matching converter is best
-    ConvFactories_t::iterator h = gConvFactories.find(fullType);
-    if (h != gConvFactories.end()) {
+    const ConvFactories_t& factories = gConvFactories.Read();
+    ConvFactories_t::const_iterator h = factories.find(fullType);
+    if (h != factories.end()) {
         return (h->second)(dims);
     }
 
@@ -3254,8 +3493,8 @@ CPyCppyy::Converter* CPyCppyy::CreateConverter(const std::string& fullType, cdim
 
 // a full, qualified matching converter is preferred
     if (resolvedType != fullType) {
-        h = gConvFactories.find(resolvedType);
-        if (h != gConvFactories.end())
+        h = factories.find(resolvedType);
+        if (h != factories.end())
             return (h->second)(dims);
     }
 
@@ -3265,8 +3504,8 @@ CPyCppyy::Converter* CPyCppyy::CreateConverter(const std::string& fullType, cdim
     std::string realType   = TypeManip::clean_type(resolvedType, false, true);
 
 // accept unqualified type (as python does not know about qualifiers)
-    h = gConvFactories.find((isConst ? "const " : "") + realType + cpd);
-    if (h != gConvFactories.end())
+    h = factories.find((isConst ? "const " : "") + realType + cpd);
+    if (h != factories.end())
         return (h->second)(dims);
 
 // mutable pointer references (T*&) are incompatible with Python's object model
@@ -3280,16 +3519,16 @@ CPyCppyy::Converter* CPyCppyy::CreateConverter(const std::string& fullType, cdim
 // drop const, as that is mostly meaningless to python (with the exception
 // of c-strings, but those are specialized in the converter map)
     if (isConst) {
-        h = gConvFactories.find(realType + cpd);
-        if (h != gConvFactories.end())
+        h = factories.find(realType + cpd);
+        if (h != factories.end())
             return (h->second)(dims);
     }
 
 //-- still nothing? try pointer instead of array (for builtins)
     if (cpd.compare(0, 3, "*[]") == 0) {
     // special case, array of pointers
-        h = gConvFactories.find(realType + " ptr");
-        if (h != gConvFactories.end()) {
+        h = factories.find(realType + " ptr");
+        if (h != factories.end()) {
         // upstream treats the pointer type as the array element type, but that pointer is
         // treated as a low-level view as well, unless it's a void*/char* so adjust the dims
             if (realType != "void" && realType != "char") {
@@ -3311,14 +3550,14 @@ CPyCppyy::Converter* CPyCppyy::CreateConverter(const std::string& fullType, cdim
 
     } else if (!cpd.empty() && (std::string::size_type)std::count(cpd.begin(), cpd.end(), '*') == cpd.size()) {
     // simple array; set or resize as necessary
-        h = gConvFactories.find(realType + " ptr");
-        if (h != gConvFactories.end())
+        h = factories.find(realType + " ptr");
+        if (h != factories.end())
             return (h->second)((!dims && 1 < cpd.size()) ? dims_t(cpd.size()) : dims);
 
     }  else if (2 <= cpd.size() && (std::string::size_type)std::count(cpd.begin(), cpd.end(), '[') == cpd.size() / 2) {
     // fixed array, dims will have size if available
-        h = gConvFactories.find(realType + " ptr");
-        if (h != gConvFactories.end())
+        h = factories.find(realType + " ptr");
+        if (h != factories.end())
             return (h->second)(dims);
     }
 
@@ -3410,14 +3649,14 @@ CPyCppyy::Converter* CPyCppyy::CreateConverter(const std::string& fullType, cdim
 
     if (!result && cpd == "&&") {
     // for builtin, can use const-ref for r-ref
-        h = gConvFactories.find("const " + realType + "&");
-        if (h != gConvFactories.end())
+        h = factories.find("const " + realType + "&");
+        if (h != factories.end())
             return (h->second)(dims);
     // else, unhandled moves
         result = new NotImplementedConverter{PyExc_NotImplementedError, "this method cannot (yet) be called"};
     }
 
-    if (!result && h != gConvFactories.end())
+    if (!result && h != factories.end())
     // converter factory available, use it to create converter
         result = (h->second)(dims);
     else if (!result) {
@@ -3434,8 +3673,8 @@ CPyCppyy::Converter* CPyCppyy::CreateConverter(const std::string& fullType, cdim
     return result;
 }
 
-CPYCPPYY_EXPORT
-CPyCppyy::Converter* CPyCppyy::CreateConverter(Cppyy::TCppType_t type, cdims_t dims)
+static CPyCppyy::Converter* CreateConverterForType(
+    Cppyy::TCppType_t type, CPyCppyy::cdims_t dims, ConvRecipe& recipe)
 {
 // The matching of the fulltype to a converter factory goes through up to five levels:
 //   1) full, exact match
@@ -3448,9 +3687,10 @@ CPyCppyy::Converter* CPyCppyy::CreateConverter(Cppyy::TCppType_t type, cdims_t d
 
 // an exactly matching converter is best
     std::string fullType = Cppyy::GetTypeAsString(type);
-    ConvFactories_t::iterator h = gConvFactories.find(fullType);
-    if (h != gConvFactories.end()) {
-        return (h->second)(dims);
+    const ConvFactories_t& factories = gConvFactories.Read();
+    ConvFactories_t::const_iterator h = factories.find(fullType);
+    if (h != factories.end()) {
+        return recipe.Factory(h->second, dims);
     }
 
 // resolve typedefs etc.
@@ -3459,9 +3699,9 @@ CPyCppyy::Converter* CPyCppyy::CreateConverter(Cppyy::TCppType_t type, cdims_t d
 
 // a full, qualified matching converter is preferred
     if (resolvedTypeStr != fullType) {
-        h = gConvFactories.find(resolvedTypeStr);
-        if (h != gConvFactories.end()) {
-            return (h->second)(dims);
+        h = factories.find(resolvedTypeStr);
+        if (h != factories.end()) {
+            return recipe.Factory(h->second, dims);
         }
     }
 
@@ -3473,9 +3713,9 @@ CPyCppyy::Converter* CPyCppyy::CreateConverter(Cppyy::TCppType_t type, cdims_t d
     std::string realUnresolvedTypeStr   = TypeManip::clean_type(fullType, false, true);
 
 // accept unqualified type (as python does not know about qualifiers)
-    h = gConvFactories.find((isConst ? "const " : "") + realTypeStr + cpd);
-    if (h != gConvFactories.end())
-        return (h->second)(dims);
+    h = factories.find((isConst ? "const " : "") + realTypeStr + cpd);
+    if (h != factories.end())
+        return recipe.Factory(h->second, dims);
 
 // mutable pointer references (T*&) are incompatible with Python's object model
     if (!isConst && cpd == "*&") {
@@ -3488,17 +3728,17 @@ CPyCppyy::Converter* CPyCppyy::CreateConverter(Cppyy::TCppType_t type, cdims_t d
 // drop const, as that is mostly meaningless to python (with the exception
 // of c-strings, but those are specialized in the converter map)
     if (isConst) {
-        h = gConvFactories.find(realTypeStr + cpd);
-        if (h != gConvFactories.end()) {
-            return (h->second)(dims);
+        h = factories.find(realTypeStr + cpd);
+        if (h != factories.end()) {
+            return recipe.Factory(h->second, dims);
         }
     }
 
 //-- still nothing? try pointer instead of array (for builtins)
     if (cpd.compare(0, 3, "*[]") == 0) {
     // special case, array of pointers
-        h = gConvFactories.find(realTypeStr + " ptr");
-        if (h != gConvFactories.end()) {
+        h = factories.find(realTypeStr + " ptr");
+        if (h != factories.end()) {
         // upstream treats the pointer type as the array element type, but that pointer is
         // treated as a low-level view as well, unless it's a void*/char* so adjust the dims
             if (realTypeStr != "void" && realTypeStr != "char") {
@@ -3513,22 +3753,22 @@ CPyCppyy::Converter* CPyCppyy::CreateConverter(Cppyy::TCppType_t type, cdims_t d
                         newdims[i] = dims[i-1];
                 }
 
-                return (h->second)(newdims);
+                return recipe.Factory(h->second, newdims);
             }
-            return (h->second)(dims);
+            return recipe.Factory(h->second, dims);
         }
 
     } else if (!cpd.empty() && (std::string::size_type)std::count(cpd.begin(), cpd.end(), '*') == cpd.size()) {
     // simple array; set or resize as necessary
-        h = gConvFactories.find(realTypeStr + " ptr");
-        if (h != gConvFactories.end())
-            return (h->second)((!dims && 1 < cpd.size()) ? dims_t(cpd.size()) : dims);
+        h = factories.find(realTypeStr + " ptr");
+        if (h != factories.end())
+            return recipe.Factory(h->second, (!dims && 1 < cpd.size()) ? dims_t(cpd.size()) : dims);
 
     }  else if (2 <= cpd.size() && (std::string::size_type)std::count(cpd.begin(), cpd.end(), '[') == cpd.size() / 2) {
     // fixed array, dims will have size if available
-        h = gConvFactories.find(realTypeStr + " ptr");
-        if (h != gConvFactories.end())
-            return (h->second)(dims);
+        h = factories.find(realTypeStr + " ptr");
+        if (h != factories.end())
+            return recipe.Factory(h->second, dims);
     }
 
 //-- special case: initializer list
@@ -3610,12 +3850,10 @@ CPyCppyy::Converter* CPyCppyy::CreateConverter(Cppyy::TCppType_t type, cdims_t d
         // std::byte is a special enum class used to access raw memory
         Cppyy::TCppScope_t raw;
         if (Cppyy::GetSmartPtrInfo(realTypeStr, &raw, nullptr)) {
-            if (cpd == "") {
-                result = new SmartPtrConverter(klass, raw, control);
-            } else if (cpd == "&") {
-                result = new SmartPtrConverter(klass, raw);
-            } else if (cpd == "*" && dims.ndim() == UNKNOWN_SIZE) {
-                result = new SmartPtrConverter(klass, raw, control, true);
+            result = selectSmartPtrCnv(klass, raw, cpd, dims, control);
+            if (result) {
+                recipe.fKind = ConvRecipe::kSmartPtr;
+                recipe.fRaw  = raw;
             }
         }
 
@@ -3629,29 +3867,40 @@ CPyCppyy::Converter* CPyCppyy::CreateConverter(Cppyy::TCppType_t type, cdims_t d
                ) {
                 static STLIteratorConverter c;
                 result = &c;
+                recipe.fKind   = ConvRecipe::kShared;
+                recipe.fShared = result;
             } else if(realTypeStr != "int8_t" and realTypeStr != "uint8_t") {
        // -- Cling WORKAROUND
                 result = selectInstanceCnv(klass, cpd, dims, isConst, control);
+                if (result) recipe.fKind = ConvRecipe::kInstance;
             }
         }
+
+        if (recipe.fKind == ConvRecipe::kInstance || recipe.fKind == ConvRecipe::kSmartPtr) {
+            recipe.fClass   = klass;
+            recipe.fCpd     = cpd;
+            recipe.fDims    = dims;
+            recipe.fIsConst = isConst;
+            recipe.fControl = control;
+        }
     }
     const std::string failure_msg("Failed to convert type: " + fullType + "; resolved: " + resolvedTypeStr + "; real: " + realTypeStr + "; realUnresolvedType: " + realUnresolvedTypeStr + "; cpd: " + cpd);
 
     if (!result && cpd == "&&") {
     // for builtin, can use const-ref for r-ref
-        h = gConvFactories.find("const " + realTypeStr + "&");
-        if (h != gConvFactories.end())
-            return (h->second)(dims);
-        h = gConvFactories.find("const " + realUnresolvedTypeStr + "&");
-        if (h != gConvFactories.end())
-            return (h->second)(dims);
+        h = factories.find("const " + realTypeStr + "&");
+        if (h != factories.end())
+            return recipe.Factory(h->second, dims);
+        h = factories.find("const " + realUnresolvedTypeStr + "&");
+        if (h != factories.end())
+            return recipe.Factory(h->second, dims);
     // else, unhandled moves
         result = new NotImplementedConverter{PyExc_NotImplementedError, "this method cannot (yet) be called"};
     }
 
-    if (!result && h != gConvFactories.end()) {
+    if (!result && h != factories.end()) {
     // converter factory available, use it to create converter
-        result = (h->second)(dims);
+        result = recipe.Factory(h->second, dims);
     } else if (!result) {
     // default to something reasonable, assuming "user knows best"
         if (cpd.size() == 2 && cpd != "&&") {// "**", "*[]", "*&"
@@ -3667,6 +3916,37 @@ CPyCppyy::Converter* CPyCppyy::CreateConverter(Cppyy::TCppType_t type, cdims_t d
     return result;
 }
 
+//----------------------------------------------------------------------------
+CPYCPPYY_EXPORT
+CPyCppyy::Converter* CPyCppyy::CreateConverter(Cppyy::TCppType_t type, cdims_t dims)
+{
+// The resolution of the type to a converter is string-based and costly, so it's done
+// once per distinct type and dimensions, with the outcome replayed after.
+    ConvCacheKey_t key{type, dims};
+    ConvRecipe recipe;
+    {
+        LockGuard lock(gConvCacheMutex);
+        auto c = gConvCache.find(key);
+        if (c != gConvCache.end())
+            recipe = c->second;
+    }
+
+    if (recipe.fKind != ConvRecipe::kNone) {
+        Converter* result = recipe.Replay();
+        if (result)
+            return result;
+        recipe = ConvRecipe{};
+    }
+
+    Converter* result = CreateConverterForType(type, dims, recipe);
+    if (result && recipe.fKind != ConvRecipe::kNone) {
+        LockGuard lock(gConvCacheMutex);
+        gConvCache.emplace(std::move(key), std::move(recipe));
+    }
+
+    return result;
+}
+
 //----------------------------------------------------------------------------
 CPYCPPYY_EXPORT
 void CPyCppyy::DestroyConverter(Converter* p)
@@ -3680,12 +3960,11 @@ CPYCPPYY_EXPORT
 bool CPyCppyy::RegisterConverter(const std::string& name, cf_t fac)
 {
 // register a custom converter
-    auto f = gConvFactories.find(name);
-    if (f != gConvFactories.end())
-        return false;
-
-    gConvFactories[name] = fac;
-    return true;
+    bool added = gConvFactories.Update([&](ConvFactories_t& factories) {
+        return factories.emplace(name, fac).second;
+    });
+    if (added) ClearConvCache();
+    return added;
 }
 
 //----------------------------------------------------------------------------
@@ -3693,16 +3972,19 @@ CPYCPPYY_EXPORT
 bool CPyCppyy::RegisterConverterAlias(const std::string& name, const std::string& target)
 {
 // register a custom converter that is a reference to an existing converter
-    auto f = gConvFactories.find(name);
-    if (f != gConvFactories.end())
-        return false;
+    bool added = gConvFactories.Update([&](ConvFactories_t& factories) {
+        if (factories.find(name) != factories.end())
+            return false;
 
-    auto t = gConvFactories.find(target);
-    if (t == gConvFactories.end())
-        return false;
+        auto t = factories.find(target);
+        if (t == factories.end())
+            return false;
 
-    gConvFactories[name] = t->second;
-    return true;
+        factories[name] = t->second;
+        return true;
+    });
+    if (added) ClearConvCache();
+    return added;
 }
 
 //----------------------------------------------------------------------------
@@ -3710,12 +3992,90 @@ CPYCPPYY_EXPORT
 bool CPyCppyy::UnregisterConverter(const std::string& name)
 {
 // remove a custom converter
-    auto f = gConvFactories.find(name);
-    if (f != gConvFactories.end()) {
-        gConvFactories.erase(f);
-        return true;
+    bool removed = gConvFactories.Update([&](ConvFactories_t& factories) {
+        return factories.erase(name) != 0;
+    });
+    if (removed) ClearConvCache();
+    return removed;
+}
+
+//----------------------------------------------------------------------------
+// Direct unboxing of the common, exact cases for builtin scalar arguments. Anything
+// else (bool for integers, int for floats, subclasses, ctypes, out of range values,
+// gDefaultObject, etc.) is rejected without setting an error and left to SetArg().
+template<typename T, T CPyCppyy::Parameter::Value::* field, char tc>
+static bool UnboxIntegerArg(PyObject* pyobject, CPyCppyy::Parameter& para)
+{
+    if (!PyLong_CheckExact(pyobject))
+        return false;
+
+    int overflow = 0;
+    PY_LONG_LONG l = PyLong_AsLongLongAndOverflow(pyobject, &overflow);
+    if (overflow || (l == (PY_LONG_LONG)-1 && PyErr_Occurred())) {
+        PyErr_Clear();
+        return false;
     }
-    return false;
+    if (l < (PY_LONG_LONG)std::numeric_limits<T>::min() || (PY_LONG_LONG)std::numeric_limits<T>::max() < l)
+        return false;
+
+    para.fValue.*field = (T)l;
+    para.fTypeCode = tc;
+    return true;
+}
+
+template<typename T, T CPyCppyy::Parameter::Value::* field, char tc>
+static bool UnboxFloatArg(PyObject* pyobject, CPyCppyy::Parameter& para)
+{
+    if (!PyFloat_CheckExact(pyobject))
+        return false;
+
+    para.fValue.*field = (T)PyFloat_AS_DOUBLE(pyobject);
+    para.fTypeCode = tc;
+    return true;
+}
+
+static bool UnboxBoolArg(PyObject* pyobject, CPyCppyy::Parameter& para)
+{
+    if (pyobject != Py_True && pyobject != Py_False)
+        return false;
+
+    para.fValue.fBool = pyobject == Py_True;
+    para.fTypeCode = 'l';
+    return true;
+}
+
+CPyCppyy::ArgUnboxer_t CPyCppyy::GetArgUnboxer(Converter* conv)
+{
+// only the exact builtin converters qualify, as derived or custom converters may have
+// other conversion rules; type codes and storage follow the respective SetArg()
+    using P = Parameter::Value;
+    if (!conv)
+        return nullptr;
+
+    const std::type_info& ti = typeid(*conv);
+    if (ti == typeid(BoolConverter))
+        return &UnboxBoolArg;
+    if (ti == typeid(ShortConverter))
+        return &UnboxIntegerArg<short, &P::fShort, 'l'>;
+    if (ti == typeid(UShortConverter))
+        return &UnboxIntegerArg<unsigned short, &P::fUShort, 'l'>;
+    if (ti == typeid(IntConverter))
+        return &UnboxIntegerArg<int, &P::fInt, 'l'>;
+    if (ti == typeid(LongConverter))
+        return &UnboxIntegerArg<long, &P::fLong, 'l'>;
+    if (ti == typeid(LLongConverter))
+        return &UnboxIntegerArg<long long, &P::fLLong, 'q'>;
+    if (ti == typeid(FloatConverter))
+        return &UnboxFloatArg<float, &P::fFloat, 'f'>;
+    if (ti == typeid(DoubleConverter))
+        return &UnboxFloatArg<double, &P::fDouble, 'd'>;
+    return nullptr;
+}
+
+//----------------------------------------------------------------------------
+bool CPyCppyy::TouchesPython(Converter* conv)
+{
+    return dynamic_cast<PyObjectConverter*>(conv) || dynamic_cast<FunctionPointerConverter*>(conv);
 }
 
 
@@ -3746,7 +4106,7 @@ static struct InitConvFactories_t {
 public:
     InitConvFactories_t() {
     // load all converter factories in the global map 'gConvFactories'
-        CPyCppyy::ConvFactories_t& gf = gConvFactories;
+        CPyCppyy::ConvFactories_t& gf = gConvFactories.Unsynchronized();
 
     // factories for built-ins
         gf["bool"] =                        (cf_t)+[](cdims_t) { static BoolConverter c{};           return &c; };
@@ -2,6 +2,7 @@
 #define CPYCPPYY_CONVERTERS_H
 
 // Bindings
+#include "CallContext.h"
 #include "Dimensions.h"
 
 // Standard
@@ -10,9 +11,6 @@
 
 namespace CPyCppyy {
 
-struct Parameter;
-struct CallContext;
-
 class CPYCPPYY_CLASS_EXPORT Converter {
 public:
     virtual ~Converter();
@@ -32,6 +30,13 @@ public:
     virtual std::string GetFailureMsg() { return "[Converter]"; }
 };
 
+// internal converters that can check, free of side-effects, whether SetArg() will accept
+// an object (see EArgMatch); not part of the public Converter, which others derive from
+class ArgMatchConverter : public Converter {
+public:
+    virtual int ArgMatch(PyObject*) = 0;
+};
+
 // create/destroy converter from fully qualified type (public API)
 CPYCPPYY_EXPORT Converter* CreateConverter(const std::string& fullType, cdims_t dims = 0);
 CPYCPPYY_EXPORT Converter* CreateConverter(Cppyy::TCppType_t type, cdims_t dims = 0);
@@ -41,6 +46,15 @@ CPYCPPYY_EXPORT bool RegisterConverter(const std::string& name, cf_t fac);
 CPYCPPYY_EXPORT bool RegisterConverterAlias(const std::string& name, const std::string& target);
 CPYCPPYY_EXPORT bool UnregisterConverter(const std::string& name);
 
+// direct conversion of exact Python int/float/bool objects for builtin converters;
+// returns false, without setting an error, if the converter's SetArg() is needed
+typedef bool (*ArgUnboxer_t)(PyObject*, Parameter&);
+ArgUnboxer_t GetArgUnboxer(Converter*);
+
+// whether C++ may use Python objects through the converted argument (PyObject*, or a
+// callable bound to a function pointer or std::function), so the GIL must be held
+bool TouchesPython(Converter*);
+
 
 // converters for special cases (only here b/c of external use of StrictInstancePtrConverter)
 class VoidArrayConverter : public Converter {
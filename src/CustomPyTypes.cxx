@@ -5,6 +5,7 @@
 #include "Converters.h"
 #include "ProxyWrappers.h"
 #include "PyStrings.h"
+#include "Synchronization.h"
 
 // As of Python 3.12, we can't use the PyMethod_GET_FUNCTION and
 // PyMethod_GET_SELF macros anymore, as the contain asserts that check if the
@@ -109,8 +110,8 @@ PyTypeObject TypedefPointerToClass_Type = {
 };
 
 //= instancemethod object with a more efficient call function ================
-static PyMethodObject* free_list;
-static int numfree = 0;
+static CPYCPPYY_FREELIST_LOCAL PyMethodObject* free_list;
+static CPYCPPYY_FREELIST_LOCAL int numfree = 0;
 #ifndef PyMethod_MAXFREELIST
 #define PyMethod_MAXFREELIST 256
 #endif
@@ -358,4 +359,88 @@ PyTypeObject VectorIter_Type = {
     CPYCPPYY_PYTYPE_TAIL
 };
 
+
+//= CPyCppyy custom iterator for associative containers ======================
+static void associter_dealloc(associterobject* ai) {
+    PyObject_GC_UnTrack(ai);
+    if (ai->ai_state) ai->ai_free(ai->ai_state);
+    Py_XDECREF(ai->ai_container);
+    PyObject_GC_Del(ai);
+}
+
+static int associter_traverse(associterobject* ai, visitproc visit, void* arg) {
+    Py_VISIT(ai->ai_container);
+    return 0;
+}
+
+static PyObject* associter_item(associterobject* ai,
+    CPyCppyy::Converter* cnv, Cppyy::TCppScope_t klass, void* address)
+{
+// Helper; builtins are converted, objects are bound by reference into the container
+    if (cnv)
+        return cnv->FromMemory(address);
+
+    PyObject* result = BindCppObjectNoCast(
+        Cppyy::TCppObject_t(address), klass, CPyCppyy::CPPInstance::kNoMemReg);
+    if (result && (ai->ai_flags & associterobject::kNeedLifeLine))
+        PyObject_SetAttr(result, PyStrings::gLifeLine, ai->ai_container);
+    return result;
+}
+
+static PyObject* associter_iternext(associterobject* ai) {
+    if (!ai->ai_state)
+        return nullptr;
+
+    void* key = nullptr; void* value = nullptr;
+    void* elem = ai->ai_next(ai->ai_state, &key, &value);
+    if (!elem) {
+    // exhausted: release the iterator pair early, the container may go away first
+        ai->ai_free(ai->ai_state);
+        ai->ai_state = nullptr;
+        return nullptr;
+    }
+
+    if (!(ai->ai_flags & associterobject::kIsMap))
+        return associter_item(ai, ai->ai_key_converter, ai->ai_key_klass, key);
+
+    if (!(ai->ai_flags & associterobject::kAsTuple))
+        return associter_item(ai, nullptr, ai->ai_pair_klass, elem);
+
+    PyObject* pykey = associter_item(ai, ai->ai_key_converter, ai->ai_key_klass, key);
+    if (!pykey)
+        return nullptr;
+    PyObject* pyvalue = associter_item(ai, ai->ai_value_converter, ai->ai_value_klass, value);
+    if (!pyvalue) {
+        Py_DECREF(pykey);
+        return nullptr;
+    }
+
+    PyObject* result = PyTuple_New(2);
+    PyTuple_SET_ITEM(result, 0, pykey);
+    PyTuple_SET_ITEM(result, 1, pyvalue);
+    return result;
+}
+
+PyTypeObject AssocIter_Type = {
+    PyVarObject_HEAD_INIT(&PyType_Type, 0)
+    (char*)"cppyy.associter",     // tp_name
+    sizeof(associterobject),      // tp_basicsize
+    0,
+    (destructor)associter_dealloc,          // tp_dealloc
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    Py_TPFLAGS_DEFAULT |
+        Py_TPFLAGS_HAVE_GC,       // tp_flags
+    0,
+    (traverseproc)associter_traverse,       // tp_traverse
+    0, 0, 0,
+    PyObject_SelfIter,            // tp_iter
+    (iternextfunc)associter_iternext,       // tp_iternext
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0,                            // tp_del
+    0,                            // tp_version_tag
+    0,                            // tp_finalize
+    0                             // tp_vectorcall
+    CPYCPPYY_PYTYPE_TAIL
+};
+
 } // namespace CPyCppyy
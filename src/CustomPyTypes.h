@@ -74,6 +74,35 @@ struct vectoriterobject : public indexiterobject {
 
 extern PyTypeObject VectorIter_Type;
 
+//- custom iterator for std::map/std::set type containers ---------------------
+// compiled per container class: next() returns the address of the current element
+// (and of its key and mapped value) and advances, or returns nullptr when done
+typedef void* (*AssocNextFn_t)(void* state, void** key, void** value);
+typedef void  (*AssocFreeFn_t)(void* state);
+
+struct associterobject {
+    PyObject_HEAD
+    PyObject*                ai_container;
+    void*                    ai_state;
+    AssocNextFn_t            ai_next;
+    AssocFreeFn_t            ai_free;
+    CPyCppyy::Converter*     ai_key_converter;      // nullptr if key is bound as object
+    Cppyy::TCppScope_t       ai_key_klass;
+    CPyCppyy::Converter*     ai_value_converter;    // id. for the mapped value
+    Cppyy::TCppScope_t       ai_value_klass;
+    Cppyy::TCppScope_t       ai_pair_klass;         // maps only
+    int                      ai_flags;
+
+    enum EFlags {
+        kDefault        = 0x0000,
+        kNeedLifeLine   = 0x0001,
+        kIsMap          = 0x0002,
+        kAsTuple        = 0x0004,
+    };
+};
+
+extern PyTypeObject AssocIter_Type;
+
 } // namespace CPyCppyy
 
 #endif // !CPYCPPYY_CUSTOMPYTYPES_H
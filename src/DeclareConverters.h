@@ -16,12 +16,13 @@ namespace CPyCppyy {
 namespace {
 
 #define CPPYY_DECLARE_BASIC_CONVERTER(name)                                  \
-class name##Converter : public Converter {                                   \
+class name##Converter : public ArgMatchConverter {                           \
 public:                                                                      \
     bool SetArg(PyObject*, Parameter&, CallContext* = nullptr) override;      \
     PyObject* FromMemory(void*) override;                                     \
     bool ToMemory(PyObject*, void*, PyObject* = nullptr) override;            \
     std::string GetFailureMsg() override { return "[" #name "Converter]"; }   \
+    int ArgMatch(PyObject*) override;                                         \
 };                                                                           \
                                                                              \
 class Const##name##RefConverter : public Converter {                         \
@@ -272,7 +273,7 @@ public:
     std::string GetFailureMsg() override { return "[InstanceConverter]"; };
 };
 
-class InstanceRefConverter : public Converter  {
+class InstanceRefConverter : public ArgMatchConverter  {
 public:
     InstanceRefConverter(Cppyy::TCppScope_t klass, bool isConst) :
         fClass(klass), fIsConst(isConst) {}
@@ -282,6 +283,7 @@ public:
     PyObject* FromMemory(void* address) override;
     bool HasState() override { return true; }
     std::string GetFailureMsg() override { return "[InstanceRefConverter]"; };
+    int ArgMatch(PyObject*) override;
 
 protected:
     Cppyy::TCppScope_t fClass;
@@ -486,10 +488,14 @@ public:
 
 protected:
     void Clear();
+    Converter* GetElementConverter();
+    bool IsBulkCopyable(PyObject** items, Py_ssize_t len);
 
 protected:
     void*             fBuffer = nullptr;
-    std::vector<Converter*> fConverters;
+    Converter*        fElementConverter = nullptr;
+    bool              fHasElementConverter = false;
+    bool              fDestruct = false;    // elements in fBuffer were constructed
     std::string       fValueTypeName;
     Cppyy::TCppScope_t fValueType;
     size_t            fValueSize;
@@ -0,0 +1,118 @@
+// Bindings
+#include "CPyCppyy.h"
+#include "DestructionQueue.h"
+
+// Standard
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+
+//- worker thread ------------------------------------------------------------
+namespace {
+
+class DestructionWorker {
+public:
+    static DestructionWorker& Get() {
+        static DestructionWorker* worker = new DestructionWorker{};   // leaked: thread is detached
+        return *worker;
+    }
+
+    void Push(Cppyy::TCppScope_t klass, void* cppobj, bool isValue) {
+        {
+            std::lock_guard<std::mutex> lock(fMutex);
+            fQueue.push_back(Entry{klass, cppobj, isValue});
+            fPending += 1;
+            if (!fStarted) {
+                fStarted = true;
+                std::thread(&DestructionWorker::Work, this).detach();
+            // objects released during finalization are queued too, so drain last
+                Py_AtExit(&DestructionWorker::AtExit);
+            }
+        }
+        fCondition.notify_one();
+    }
+
+    void WaitEmpty() {
+        std::unique_lock<std::mutex> lock(fMutex);
+        fDone.wait(lock, [this] { return fPending == 0; });
+    }
+
+    size_t Pending() {
+        std::lock_guard<std::mutex> lock(fMutex);
+        return fPending;
+    }
+
+private:
+    struct Entry {
+        Cppyy::TCppScope_t fClass;
+        void*              fObject;
+        bool               fIsValue;
+    };
+
+    void Work() {
+        std::deque<Entry> batch;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(fMutex);
+                fCondition.wait(lock, [this] { return !fQueue.empty(); });
+                batch.swap(fQueue);
+            }
+
+        // destructors run without the GIL (this thread never takes it)
+            for (const auto& e : batch) {
+                if (e.fIsValue) {
+                    Cppyy::CallDestructor(e.fClass, e.fObject);
+                    Cppyy::Deallocate(e.fClass, e.fObject);
+                } else
+                    Cppyy::Destruct(e.fClass, e.fObject);
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(fMutex);
+                fPending -= batch.size();
+            }
+            batch.clear();
+            fDone.notify_all();
+        }
+    }
+
+    static void AtExit() { Get().WaitEmpty(); }
+
+private:
+    std::mutex fMutex;
+    std::condition_variable fCondition;
+    std::condition_variable fDone;
+    std::deque<Entry> fQueue;
+    size_t fPending = 0;
+    bool fStarted = false;
+};
+
+} // unnamed namespace
+
+
+//- public functions ---------------------------------------------------------
+void CPyCppyy::DestructionQueue::Push(
+    Cppyy::TCppScope_t klass, Cppyy::TCppObject_t cppobj, bool isValue)
+{
+    DestructionWorker::Get().Push(klass, cppobj.data, isValue);
+}
+
+//----------------------------------------------------------------------------
+void CPyCppyy::DestructionQueue::Flush()
+{
+    DestructionWorker& worker = DestructionWorker::Get();
+    if (!worker.Pending())
+        return;
+
+    Py_BEGIN_ALLOW_THREADS
+    worker.WaitEmpty();
+    Py_END_ALLOW_THREADS
+}
+
+//----------------------------------------------------------------------------
+size_t CPyCppyy::DestructionQueue::Pending()
+{
+    return DestructionWorker::Get().Pending();
+}
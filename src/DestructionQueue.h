@@ -0,0 +1,33 @@
+#ifndef CPYCPPYY_DESTRUCTIONQUEUE_H
+#define CPYCPPYY_DESTRUCTIONQUEUE_H
+
+// Bindings
+#include "Cppyy.h"
+
+// Standard
+#include <stddef.h>
+
+
+namespace CPyCppyy {
+
+/** Deferred destruction of Python-owned C++ objects, for classes that opt in (see
+    CPPScope::kDeferDestruct): the destructors run on a background thread, without
+    the GIL, rather than synchronously when the last Python reference goes away
+ */
+
+class DestructionQueue {
+public:
+// queue the object for destruction, followed by deallocation if it was allocated as a
+// value (cf. CPPInstance::kIsValue); the worker thread is started on first use
+    static void Push(Cppyy::TCppScope_t klass, Cppyy::TCppObject_t cppobj, bool isValue);
+
+// wait until all queued objects have been destroyed; releases the GIL while waiting
+    static void Flush();
+
+// number of objects queued or in the process of being destroyed
+    static size_t Pending();
+};
+
+} // namespace CPyCppyy
+
+#endif // !CPYCPPYY_DESTRUCTIONQUEUE_H
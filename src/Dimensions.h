@@ -80,6 +80,20 @@ public:
     dim_t& operator[](dim_t i)       { return fDims[i+1]; }
 
     Dimensions sub() const { return fDims ? Dimensions(fDims[0]-1, fDims+2) : Dimensions(); }
+
+    bool operator==(const Dimensions& d) const {
+        if (!fDims || !d.fDims) return fDims == d.fDims;
+        return std::equal(fDims, fDims+fDims[0]+1, d.fDims, d.fDims+d.fDims[0]+1);
+    }
+
+    size_t hash() const {
+        size_t h = 0;
+        if (fDims) {
+            for (dim_t i = 0; i <= fDims[0]; ++i)
+                h = h*31 + (size_t)fDims[i];
+        }
+        return h;
+    }
 };
 
 typedef Dimensions dims_t;
@@ -0,0 +1,250 @@
+// Bindings
+#include "CPyCppyy.h"
+#include "DirectCall.h"
+
+// Standard
+#include <string>
+#include <type_traits>
+#include <utility>
+
+
+// Direct calls pass all integer-like arguments (incl. bool and pointers) as intptr_t
+// and floating point arguments as double, positionally. This matches the calling
+// convention of the declared types only on 64b ABIs that pass the first arguments in
+// full-width registers; elsewhere, the generic wrapper is always used. Converted
+// integer arguments are read from the start of the parameter value, which requires
+// a little-endian layout if the converter stored a wider type than declared.
+#if (defined(__x86_64__) || defined(_M_X64) || defined(_M_ARM64) || \
+    (defined(__aarch64__) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__))
+#define CPYCPPYY_DIRECTCALL_ABI 1
+#endif
+
+
+//- typed thunks -------------------------------------------------------------
+namespace {
+
+using namespace CPyCppyy::DirectCall;
+
+template<typename T>
+inline T SlotValue(const Slot& s);
+
+template<>
+inline intptr_t SlotValue<intptr_t>(const Slot& s) { return s.fInt; }
+
+template<>
+inline double SlotValue<double>(const Slot& s) { return s.fDouble; }
+
+template<typename R, typename... Args, size_t... I>
+inline void InvokeImpl(Cppyy::TCppFuncAddr_t faddr, const Slot* args, Slot* result,
+    std::index_sequence<I...>)
+{
+    auto fptr = reinterpret_cast<R (*)(Args...)>(faddr);
+    if constexpr (std::is_void<R>::value)
+        fptr(SlotValue<Args>(args[I])...);
+    else if constexpr (std::is_same<R, double>::value)
+        result->fDouble = fptr(SlotValue<Args>(args[I])...);
+    else
+        result->fInt = fptr(SlotValue<Args>(args[I])...);
+}
+
+template<typename R, typename... Args>
+void Invoke(Cppyy::TCppFuncAddr_t faddr, const Slot* args, Slot* result)
+{
+    InvokeImpl<R, Args...>(faddr, args, result, std::index_sequence_for<Args...>{});
+}
+
+// select the thunk for nargs arguments, with bit i of dmask set for double arguments
+template<typename R, typename... Args>
+Invoker_t Select(int nargs, unsigned int dmask)
+{
+    constexpr int cur = (int)sizeof...(Args);
+    if constexpr (cur == kMaxArgs)
+        return &Invoke<R, Args...>;
+    else {
+        if (cur == nargs)
+            return &Invoke<R, Args...>;
+        if (dmask & (1u << cur))
+            return Select<R, Args..., double>(nargs, dmask);
+        return Select<R, Args..., intptr_t>(nargs, dmask);
+    }
+}
+
+inline char ClassifyArg(const std::string& cpptype)
+{
+// integer codes follow the return codes below, with 'c'/'a'/'C' for char, signed
+// char, and unsigned char, respectively
+    static const std::pair<const char*, char> args[] = {
+        {"bool", 'b'}, {"char", 'c'}, {"signed char", 'a'}, {"unsigned char", 'C'},
+        {"short", 'h'}, {"unsigned short", 'H'}, {"int", 'i'}, {"unsigned int", 'I'},
+        {"long", 'l'}, {"unsigned long", 'L'}, {"long long", 'q'},
+        {"unsigned long long", 'Q'}, {"double", 'd'}};
+    for (const auto& a : args) {
+        if (cpptype == a.first)
+            return a.second;
+    }
+    if (!cpptype.empty() && cpptype.back() == '*')
+        return 'p';
+    return '\0';
+}
+
+inline char ClassifyReturn(const std::string& cpptype)
+{
+// codes follow the executors for these types; char types (returned as str) and
+// pointers (bound as objects or views) are left to the executors
+    static const std::pair<const char*, char> rets[] = {
+        {"void", 'v'}, {"bool", 'b'}, {"short", 'h'}, {"unsigned short", 'H'},
+        {"int", 'i'}, {"unsigned int", 'I'}, {"long", 'l'}, {"unsigned long", 'L'},
+        {"long long", 'q'}, {"unsigned long long", 'Q'}, {"double", 'd'}};
+    for (const auto& r : rets) {
+        if (cpptype == r.first)
+            return r.second;
+    }
+    return '\0';
+}
+
+#ifdef WITH_THREAD
+class GILControl {
+public:
+    GILControl() : fSave(PyEval_SaveThread()) { }
+    ~GILControl() {
+        PyEval_RestoreThread(fSave);
+    }
+private:
+    PyThreadState* fSave;
+};
+#endif
+
+} // unnamed namespace
+
+
+//- public functions ---------------------------------------------------------
+bool CPyCppyy::DirectCall::Prepare(Cppyy::TCppMethod_t method, Signature& sig)
+{
+#ifdef CPYCPPYY_DIRECTCALL_ABI
+    if (!method || Cppyy::IsConstructor(method))
+        return false;
+
+    const int nargs = (int)Cppyy::GetMethodNumArgs(method);
+    if (kMaxArgs < nargs)
+        return false;
+
+    char rcode = ClassifyReturn(
+        Cppyy::GetTypeAsString(Cppyy::ResolveType(Cppyy::GetMethodReturnType(method))));
+    if (!rcode)
+        return false;
+
+    unsigned int dmask = 0;
+    for (int iarg = 0; iarg < nargs; ++iarg) {
+        char acode = ClassifyArg(Cppyy::GetMethodArgCanonTypeAsString(method, iarg));
+        if (!acode)
+            return false;
+        if (acode == 'd')
+            dmask |= (1u << iarg);
+        sig.fArgCodes[iarg] = acode;
+    }
+
+// the address is only available for functions that have been emitted
+    Cppyy::TCppFuncAddr_t faddr = Cppyy::GetFunctionAddress(method, false /* don't check fast path envar */);
+    if (!faddr)
+        return false;
+
+    if (rcode == 'v')
+        sig.fInvoker = Select<void>(nargs, dmask);
+    else if (rcode == 'd')
+        sig.fInvoker = Select<double>(nargs, dmask);
+    else
+        sig.fInvoker = Select<intptr_t>(nargs, dmask);
+    sig.fAddress = faddr;
+    sig.fNArgs   = (uint8_t)nargs;
+    sig.fRetCode = rcode;
+    return true;
+#else
+    (void)method; (void)sig;
+    return false;
+#endif
+}
+
+//----------------------------------------------------------------------------
+bool CPyCppyy::DirectCall::Call(const Signature& sig, CallContext* ctxt, PyObject*& result)
+{
+// defaulted arguments are only known to the generic wrapper
+    if (!sig.fRetCode || ctxt->GetSize() != (size_t)sig.fNArgs)
+        return false;
+
+// unpack the converted arguments; bail out for conversions that produced something
+// other than a plain value (e.g. a reference to a temporary)
+    Slot args[kMaxArgs];
+    Parameter* params = ctxt->GetArgs();
+    for (int iarg = 0; iarg < (int)sig.fNArgs; ++iarg) {
+        const Parameter& p = params[iarg];
+        switch (sig.fArgCodes[iarg]) {
+        case 'd':
+            if (p.fTypeCode != 'd') return false;
+            args[iarg].fDouble = p.fValue.fDouble;
+            break;
+        case 'p':
+            if (p.fTypeCode != 'p' && p.fTypeCode != 'V') return false;
+            args[iarg].fInt = (intptr_t)p.fValue.fVoidp;
+            break;
+        default:
+        // converters may store a wider type than declared (e.g. char as long), so
+        // read the declared type and extend it as the caller would
+            if (p.fTypeCode != 'l' && p.fTypeCode != 'L' && p.fTypeCode != 'q' && p.fTypeCode != 'Q')
+                return false;
+            switch (sig.fArgCodes[iarg]) {
+            case 'b': args[iarg].fInt = (intptr_t)p.fValue.fBool;           break;
+            case 'c': args[iarg].fInt = (intptr_t)(char)p.fValue.fInt8;     break;
+            case 'a': args[iarg].fInt = (intptr_t)p.fValue.fInt8;           break;
+            case 'C': args[iarg].fInt = (intptr_t)p.fValue.fUInt8;          break;
+            case 'h': args[iarg].fInt = (intptr_t)p.fValue.fShort;          break;
+            case 'H': args[iarg].fInt = (intptr_t)p.fValue.fUShort;         break;
+            case 'i': args[iarg].fInt = (intptr_t)p.fValue.fInt;            break;
+            case 'I': args[iarg].fInt = (intptr_t)p.fValue.fUInt;           break;
+            case 'l': args[iarg].fInt = (intptr_t)p.fValue.fLong;           break;
+            case 'L': args[iarg].fInt = (intptr_t)p.fValue.fULong;          break;
+            case 'q': args[iarg].fInt = (intptr_t)p.fValue.fLLong;          break;
+            case 'Q': args[iarg].fInt = (intptr_t)p.fValue.fULLong;         break;
+            default:
+                return false;
+            }
+            break;
+        }
+    }
+
+    Slot ret;
+    ret.fInt = 0;
+#ifdef WITH_THREAD
+    if (ReleasesGIL(ctxt)) {
+        GILControl gc{};
+        sig.fInvoker(sig.fAddress, args, &ret);
+    } else
+#endif
+        sig.fInvoker(sig.fAddress, args, &ret);
+
+// box the result the same way as the executors for these types do
+    switch (sig.fRetCode) {
+    case 'v':
+        if (PyErr_Occurred()) {
+            result = nullptr;
+            break;
+        }
+        Py_INCREF(Py_None);
+        result = Py_None;
+        break;
+    case 'b':
+        result = (bool)(uint8_t)ret.fInt ? Py_True : Py_False;
+        Py_INCREF(result);
+        break;
+    case 'h': result = PyInt_FromLong((short)ret.fInt); break;
+    case 'H': result = PyInt_FromLong((unsigned short)ret.fInt); break;
+    case 'i': result = PyInt_FromLong((int)ret.fInt); break;
+    case 'I': result = PyLong_FromUnsignedLong((unsigned int)ret.fInt); break;
+    case 'l': result = PyLong_FromLong((long)ret.fInt); break;
+    case 'L': result = PyLong_FromUnsignedLong((unsigned long)ret.fInt); break;
+    case 'q': result = PyLong_FromLongLong((PY_LONG_LONG)ret.fInt); break;
+    case 'Q': result = PyLong_FromUnsignedLongLong((PY_ULONG_LONG)ret.fInt); break;
+    case 'd': result = PyFloat_FromDouble(ret.fDouble); break;
+    }
+
+    return true;
+}
@@ -0,0 +1,48 @@
+#ifndef CPYCPPYY_DIRECTCALL_H
+#define CPYCPPYY_DIRECTCALL_H
+
+// Bindings
+#include "CallContext.h"
+
+// Standard
+#include <stdint.h>
+
+
+namespace CPyCppyy {
+
+namespace DirectCall {
+
+// maximum number of arguments for which a typed direct call is available
+const int kMaxArgs = 4;
+
+union Slot {
+    intptr_t fInt;
+    double   fDouble;
+};
+
+typedef void (*Invoker_t)(Cppyy::TCppFuncAddr_t, const Slot* args, Slot* result);
+
+// call information of a free or static function that is called through its address,
+// bypassing the generic wrapper (see CallContext::kUseFFI)
+struct Signature {
+    Signature() : fAddress(nullptr), fInvoker(nullptr), fRetCode('\0'), fNArgs(0), fArgCodes() {}
+
+    Cppyy::TCppFuncAddr_t fAddress;
+    Invoker_t             fInvoker;              // typed thunk for the argument kinds
+    char                  fRetCode;              // '\0' if not callable directly
+    uint8_t               fNArgs;
+    char                  fArgCodes[kMaxArgs];   // builtin type code, 'd'ouble, or 'p'ointer
+};
+
+// collect the call information of method; returns false if it can't be called directly
+bool Prepare(Cppyy::TCppMethod_t method, Signature& sig);
+
+// call through the signature with the arguments converted into ctxt; returns false,
+// without side-effects, if these arguments require the generic path
+bool Call(const Signature& sig, CallContext* ctxt, PyObject*& result);
+
+} // namespace DirectCall
+
+} // namespace CPyCppyy
+
+#endif // !CPYCPPYY_DIRECTCALL_H
@@ -0,0 +1,167 @@
+#ifndef CPYCPPYY_DISPATCHMAP_H
+#define CPYCPPYY_DISPATCHMAP_H
+
+// Standard
+#include <stdint.h>
+#include <string.h>
+
+
+namespace CPyCppyy {
+
+// maximum number of memoized signatures per overload set; when full, the least
+// recently hit entry in the probe window of a new signature is evicted
+#ifndef CPYCPPYY_DISPATCHMAP_MAXSIZE
+#define CPYCPPYY_DISPATCHMAP_MAXSIZE 64
+#endif
+
+// default policy for values that are dropped from the table: no ownership
+struct DispatchMapNoRelease {
+    template<typename T>
+    void operator()(T) const {}
+};
+
+/** Bounded, open-addressed memoization table from signature hash to callable
+ */
+
+template<typename T, typename Release = DispatchMapNoRelease>
+class DispatchMap {
+private:
+    static const uint32_t kMinSize  = 8;
+    static const uint32_t kMaxSize  = CPYCPPYY_DISPATCHMAP_MAXSIZE;
+    static const uint32_t kMaxProbe = 4;
+
+    struct Entry {
+        uint64_t fHash;
+        T        fValue;       // nullptr if slot is empty
+        bool     fRecent;      // second-chance bit for eviction
+    };
+
+public:
+    DispatchMap() : fEntries(nullptr), fSize(0), fCount(0) {}
+    DispatchMap(const DispatchMap&) = delete;
+    DispatchMap& operator=(const DispatchMap&) = delete;
+    DispatchMap(DispatchMap&& other) : fEntries(other.fEntries), fSize(other.fSize), fCount(other.fCount) {
+        other.fEntries = nullptr; other.fSize = 0; other.fCount = 0;
+    }
+    ~DispatchMap() { Clear(); }
+
+public:
+// retrieve the memoized value for the given signature, or nullptr if unknown
+    T Find(uint64_t sighash) {
+        if (!fEntries) return nullptr;
+        uint32_t mask = fSize-1;
+        for (uint32_t i = 0, idx = Index(sighash); i < kMaxProbe; ++i, idx = (idx+1) & mask) {
+            Entry& e = fEntries[idx];
+            if (!e.fValue)
+                return nullptr;      // no holes are ever created, so done
+            if (e.fHash == sighash) {
+                e.fRecent = true;
+                return e.fValue;
+            }
+        }
+        return nullptr;
+    }
+
+// memoize value for the given signature; a displaced value, which is either the old
+// value for the same signature or an evicted one, is handed to the release policy
+    void Insert(uint64_t sighash, T value) {
+        if (!fEntries || (fSize < kMaxSize && (fCount+1)*4 > fSize*3))
+            Grow();
+
+        uint32_t mask = fSize-1;
+        uint32_t start = Index(sighash);
+        for (uint32_t i = 0, idx = start; i < kMaxProbe; ++i, idx = (idx+1) & mask) {
+            Entry& e = fEntries[idx];
+            if (!e.fValue || e.fHash == sighash) {
+                T old = e.fValue;
+                if (!old) fCount += 1;
+                e.fHash = sighash; e.fValue = value; e.fRecent = true;
+                if (old) Release()(old);
+                return;
+            }
+        }
+
+    // probe window is full: grow if still allowed, else evict (second chance)
+        if (fSize < kMaxSize) {
+            Grow();
+            Insert(sighash, value);
+            return;
+        }
+
+        Entry* victim = &fEntries[start];
+        for (uint32_t i = 0, idx = start; i < 2*kMaxProbe; ++i, idx = (start+(i%kMaxProbe)) & mask) {
+            Entry& e = fEntries[idx];
+            if (!e.fRecent) {
+                victim = &e;
+                break;
+            }
+            e.fRecent = false;
+        }
+
+        T old = victim->fValue;
+        victim->fHash = sighash; victim->fValue = value; victim->fRecent = true;
+        Release()(old);
+    }
+
+    void Clear() {
+        ForEach(Release());
+        delete [] fEntries; fEntries = nullptr;
+        fSize = 0; fCount = 0;
+    }
+
+    bool Empty() const { return fCount == 0; }
+    uint32_t Size() const { return fCount; }
+    size_t MemoryUsage() const { return fSize*sizeof(Entry); }
+
+// apply f(value) to each stored value (e.g. for reference count cleanup)
+    template<typename F>
+    void ForEach(F f) const {
+        for (uint32_t i = 0; i < fSize; ++i) {
+            if (fEntries[i].fValue) f(fEntries[i].fValue);
+        }
+    }
+
+private:
+    uint32_t Index(uint64_t sighash) const {
+    // fold the high bits in, as the low bits of the signature hash are the least mixed
+        return (uint32_t)(sighash ^ (sighash >> 32)) & (fSize-1);
+    }
+
+    void Grow() {
+        Entry* old = fEntries;
+        uint32_t oldsz = fSize;
+
+        fSize = fSize ? 2*fSize : kMinSize;
+        fEntries = new Entry[fSize];
+        memset((void*)fEntries, 0, fSize*sizeof(Entry));
+        fCount = 0;
+
+    // re-insert; anything that no longer fits is dropped (it's only a cache)
+        uint32_t mask = fSize-1;
+        for (uint32_t i = 0; i < oldsz; ++i) {
+            if (!old[i].fValue)
+                continue;
+
+            bool placed = false;
+            for (uint32_t j = 0, idx = Index(old[i].fHash); j < kMaxProbe; ++j, idx = (idx+1) & mask) {
+                if (!fEntries[idx].fValue) {
+                    fEntries[idx] = old[i];
+                    fCount += 1;
+                    placed = true;
+                    break;
+                }
+            }
+            if (!placed) Release()(old[i].fValue);
+        }
+        delete [] old;
+    }
+
+private:
+    Entry*   fEntries;
+    uint32_t fSize;
+    uint32_t fCount;
+};
+
+} // namespace CPyCppyy
+
+#endif // !CPYCPPYY_DISPATCHMAP_H
@@ -6,6 +6,7 @@
 #include "LowLevelViews.h"
 #include "ProxyWrappers.h"
 #include "PyStrings.h"
+#include "Synchronization.h"
 #include "TypeManip.h"
 #include "Utility.h"
 
@@ -16,13 +17,15 @@
 #include <sstream>
 #include <utility>
 #include <sys/types.h>
+#include <typeinfo>
+#include <unordered_map>
 #include <complex>
 
 
 //- data _____________________________________________________________________
 namespace CPyCppyy {
     typedef std::unordered_map<std::string, ef_t> ExecFactories_t;
-    static ExecFactories_t gExecFactories;
+    static RCUTable<ExecFactories_t> gExecFactories;
 
     extern PyObject* gNullPtrObject;
 
@@ -135,6 +138,70 @@ static inline PyObject* CPyCppyy_PyBool_FromLong(long b)
     return result;
 }
 
+// call and box for the builtin executors; shared with GetTypedExecute(), so that
+// trampolines can skip the virtual Execute()
+template<typename R>
+static PyObject* ExecuteBuiltin(
+    Cppyy::TCppMethod_t method, Cppyy::TCppObject_t self, CPyCppyy::CallContext* ctxt);
+
+template<>
+PyObject* ExecuteBuiltin<void>(
+    Cppyy::TCppMethod_t method, Cppyy::TCppObject_t self, CPyCppyy::CallContext* ctxt)
+{
+    GILCallV(method, self, ctxt);
+    if (PyErr_Occurred()) return nullptr;
+    Py_RETURN_NONE;
+}
+
+template<>
+PyObject* ExecuteBuiltin<bool>(
+    Cppyy::TCppMethod_t method, Cppyy::TCppObject_t self, CPyCppyy::CallContext* ctxt)
+{
+    return CPyCppyy_PyBool_FromLong((bool)GILCallB(method, self, ctxt));
+}
+
+template<>
+PyObject* ExecuteBuiltin<short>(
+    Cppyy::TCppMethod_t method, Cppyy::TCppObject_t self, CPyCppyy::CallContext* ctxt)
+{
+    return PyInt_FromLong((short)GILCallH(method, self, ctxt));
+}
+
+template<>
+PyObject* ExecuteBuiltin<int>(
+    Cppyy::TCppMethod_t method, Cppyy::TCppObject_t self, CPyCppyy::CallContext* ctxt)
+{
+    return PyInt_FromLong((int)GILCallI(method, self, ctxt));
+}
+
+template<>
+PyObject* ExecuteBuiltin<long>(
+    Cppyy::TCppMethod_t method, Cppyy::TCppObject_t self, CPyCppyy::CallContext* ctxt)
+{
+    return PyLong_FromLong((long)GILCallL(method, self, ctxt));
+}
+
+template<>
+PyObject* ExecuteBuiltin<PY_LONG_LONG>(
+    Cppyy::TCppMethod_t method, Cppyy::TCppObject_t self, CPyCppyy::CallContext* ctxt)
+{
+    return PyLong_FromLongLong(GILCallLL(method, self, ctxt));
+}
+
+template<>
+PyObject* ExecuteBuiltin<float>(
+    Cppyy::TCppMethod_t method, Cppyy::TCppObject_t self, CPyCppyy::CallContext* ctxt)
+{
+    return PyFloat_FromDouble((double)GILCallF(method, self, ctxt));
+}
+
+template<>
+PyObject* ExecuteBuiltin<double>(
+    Cppyy::TCppMethod_t method, Cppyy::TCppObject_t self, CPyCppyy::CallContext* ctxt)
+{
+    return PyFloat_FromDouble((double)GILCallD(method, self, ctxt));
+}
+
 
 //- base executor implementation ---------------------------------------------
 CPyCppyy::Executor::~Executor()
@@ -147,10 +214,7 @@ PyObject* CPyCppyy::BoolExecutor::Execute(
     Cppyy::TCppMethod_t method, Cppyy::TCppObject_t self, CallContext* ctxt)
 {
 // execute <method> with argument <self, ctxt>, construct python bool return value
-    bool retval = GILCallB(method, self, ctxt);
-    PyObject* result = retval ? Py_True : Py_False;
-    Py_INCREF(result);
-    return result;
+    return ExecuteBuiltin<bool>(method, self, ctxt);
 }
 
 //----------------------------------------------------------------------------
@@ -246,7 +310,7 @@ PyObject* CPyCppyy::IntExecutor::Execute(
     Cppyy::TCppMethod_t method, Cppyy::TCppObject_t self, CallContext* ctxt)
 {
 // execute <method> with argument <self, ctxt>, construct python int return value
-    return PyInt_FromLong((int)GILCallI(method, self, ctxt));
+    return ExecuteBuiltin<int>(method, self, ctxt);
 }
 
 //----------------------------------------------------------------------------
@@ -270,7 +334,7 @@ PyObject* CPyCppyy::ShortExecutor::Execute(
     Cppyy::TCppMethod_t method, Cppyy::TCppObject_t self, CallContext* ctxt)
 {
 // execute <method> with argument <self, ctxt>, construct python int return value
-    return PyInt_FromLong((short)GILCallH(method, self, ctxt));
+    return ExecuteBuiltin<short>(method, self, ctxt);
 }
 
 //----------------------------------------------------------------------------
@@ -278,7 +342,7 @@ PyObject* CPyCppyy::LongExecutor::Execute(
     Cppyy::TCppMethod_t method, Cppyy::TCppObject_t self, CallContext* ctxt)
 {
 // execute <method> with argument <self, ctxt>, construct python long return value
-    return PyLong_FromLong((long)GILCallL(method, self, ctxt));
+    return ExecuteBuiltin<long>(method, self, ctxt);
 }
 
 //----------------------------------------------------------------------------
@@ -294,8 +358,7 @@ PyObject* CPyCppyy::LongLongExecutor::Execute(
     Cppyy::TCppMethod_t method, Cppyy::TCppObject_t self, CallContext* ctxt)
 {
 // execute <method> with argument <self, ctxt>, construct python long long return value
-    PY_LONG_LONG result = GILCallLL(method, self, ctxt);
-    return PyLong_FromLongLong(result);
+    return ExecuteBuiltin<PY_LONG_LONG>(method, self, ctxt);
 }
 
 //----------------------------------------------------------------------------
@@ -312,7 +375,7 @@ PyObject* CPyCppyy::FloatExecutor::Execute(
     Cppyy::TCppMethod_t method, Cppyy::TCppObject_t self, CallContext* ctxt)
 {
 // execute <method> with argument <self, ctxt>, construct python float return value
-    return PyFloat_FromDouble((double)GILCallF(method, self, ctxt));
+    return ExecuteBuiltin<float>(method, self, ctxt);
 }
 
 //----------------------------------------------------------------------------
@@ -320,7 +383,7 @@ PyObject* CPyCppyy::DoubleExecutor::Execute(
     Cppyy::TCppMethod_t method, Cppyy::TCppObject_t self, CallContext* ctxt)
 {
 // execute <method> with argument <self, ctxt>, construct python float return value
-    return PyFloat_FromDouble((double)GILCallD(method, self, ctxt));
+    return ExecuteBuiltin<double>(method, self, ctxt);
 }
 
 //----------------------------------------------------------------------------
@@ -432,9 +495,7 @@ PyObject* CPyCppyy::VoidExecutor::Execute(
     Cppyy::TCppMethod_t method, Cppyy::TCppObject_t self, CallContext* ctxt)
 {
 // execute <method> with argument <self, ctxt>, return None
-    GILCallV(method, self, ctxt);
-    if (PyErr_Occurred()) return nullptr;
-    Py_RETURN_NONE;
+    return ExecuteBuiltin<void>(method, self, ctxt);
 }
 
 //----------------------------------------------------------------------------
@@ -817,8 +878,9 @@ CPyCppyy::Executor* CPyCppyy::CreateExecutor(const std::string& fullType, cdims_
         return nullptr;
 
 // an exactly matching executor is best
-    ExecFactories_t::iterator h = gExecFactories.find(fullType);
-    if (h != gExecFactories.end())
+    const ExecFactories_t& factories = gExecFactories.Read();
+    ExecFactories_t::const_iterator h = factories.find(fullType);
+    if (h != factories.end())
         return (h->second)(dims);
 
 // resolve typedefs etc.
@@ -826,8 +888,8 @@ CPyCppyy::Executor* CPyCppyy::CreateExecutor(const std::string& fullType, cdims_
 
 // a full, qualified matching executor is preferred
     if (resolvedType != fullType) {
-         h = gExecFactories.find(resolvedType);
-         if (h != gExecFactories.end())
+         h = factories.find(resolvedType);
+         if (h != factories.end())
               return (h->second)(dims);
     }
 
@@ -837,30 +899,30 @@ CPyCppyy::Executor* CPyCppyy::CreateExecutor(const std::string& fullType, cdims_
     std::string realType = TypeManip::clean_type(resolvedType, false);
 
 // accept unqualified type (as python does not know about qualifiers)
-    h = gExecFactories.find(realType + cpd);
-    if (h != gExecFactories.end())
+    h = factories.find(realType + cpd);
+    if (h != factories.end())
         return (h->second)(dims);
 
 // drop const, as that is mostly meaningless to python (with the exception
 // of c-strings, but those are specialized in the converter map)
     if (isConst) {
         realType = TypeManip::remove_const(realType);
-        h = gExecFactories.find(realType + cpd);
-        if (h != gExecFactories.end())
+        h = factories.find(realType + cpd);
+        if (h != factories.end())
             return (h->second)(dims);
     }
 
 // simple array types
     if (!cpd.empty() && (std::string::size_type)std::count(cpd.begin(), cpd.end(), '*') == cpd.size()) {
-        h = gExecFactories.find(realType + " ptr");
-        if (h != gExecFactories.end())
+        h = factories.find(realType + " ptr");
+        if (h != factories.end())
             return (h->second)((!dims || dims.ndim() < (dim_t)cpd.size()) ? dims_t(cpd.size()) : dims);
     }
 
 //-- still nothing? try pointer instead of array (for builtins)
     if (cpd == "[]") {
-        h = gExecFactories.find(realType + "*");
-        if (h != gExecFactories.end())
+        h = factories.find(realType + "*");
+        if (h != factories.end())
             return (h->second)(dims);
     }
 
@@ -899,17 +961,105 @@ CPyCppyy::Executor* CPyCppyy::CreateExecutor(const std::string& fullType, cdims_
             resolvedType.substr(0, pos1), resolvedType.substr(pos2+2, pos3-pos2-1));
     } else {
     // unknown: void* may work ("user knows best"), void will fail on use of return value
-        h = (cpd == "") ? gExecFactories.find("void") : gExecFactories.find("void ptr");
+        h = (cpd == "") ? factories.find("void") : factories.find("void ptr");
     }
 
-    if (!result && h != gExecFactories.end())
+    if (!result && h != factories.end())
     // executor factory available, use it to create executor
         result = (h->second)(dims);
 
    return result;                  // may still be null
 }
 
-CPyCppyy::Executor* CPyCppyy::CreateExecutor(Cppyy::TCppType_t type, cdims_t dims)
+//- type-keyed cache ---------------------------------------------------------
+namespace {
+
+using namespace CPyCppyy;
+
+static inline Executor* selectInstanceExec(Cppyy::TCppScope_t klass,
+        const std::string& cpd, Py_ssize_t asize, bool isIterator)
+{
+    if (isIterator && cpd == "")
+        return new IteratorExecutor(klass);
+
+    if (cpd == "")
+        return new InstanceExecutor(klass);
+    else if (cpd == "&")
+        return new InstanceRefExecutor(klass);
+    else if (cpd == "**" || cpd == "*[]" || cpd == "&*")
+        return new InstancePtrPtrExecutor(klass);
+    else if (cpd == "*&")
+        return new InstancePtrRefExecutor(klass);
+    else if (cpd == "[]") {
+        if (0 < asize)
+            return new InstanceArrayExecutor(klass, asize);
+        return new InstancePtrRefExecutor(klass);
+    }
+    return new InstancePtrExecutor(klass);
+}
+
+// outcome of the (string-based) resolution of a type to an executor, to be replayed
+// for later requests with the same type and dimensions; the fallbacks for unknown
+// types are not recorded, as these may resolve once more C++ is loaded
+struct ExecRecipe {
+    enum EKind { kNone, kFactory, kInstance };
+
+    ExecRecipe() : fKind(kNone), fFactory(nullptr), fASize(0), fIsIterator(false) {}
+
+    Executor* Factory(ef_t f, cdims_t dims) {
+        fKind = kFactory; fFactory = f; fDims = dims;
+        return f(fDims);
+    }
+
+    Executor* Replay() const {
+        switch (fKind) {
+        case kFactory:
+            return fFactory(fDims);
+        case kInstance: {
+        // by-value returns of classes found to be iterators after the fact (see the
+        // pythonization of begin()) change executor
+            bool isIterator = fIsIterator ||
+                (fCpd == "" && gIteratorTypes.find(fFullType) != gIteratorTypes.end());
+            return selectInstanceExec(fClass, fCpd, fASize, isIterator);
+        }
+        default:
+            return nullptr;
+        }
+    }
+
+    EKind              fKind;
+    ef_t               fFactory;
+    dims_t             fDims;
+    Cppyy::TCppScope_t fClass;
+    std::string        fCpd;
+    std::string        fFullType;
+    Py_ssize_t         fASize;
+    bool               fIsIterator;
+};
+
+typedef std::pair<Cppyy::TCppType_t, dims_t> ExecCacheKey_t;
+struct ExecCacheHash {
+    size_t operator()(const ExecCacheKey_t& key) const {
+        return std::hash<Cppyy::TCppType_t>{}(key.first) ^ key.second.hash();
+    }
+};
+
+typedef std::unordered_map<ExecCacheKey_t, ExecRecipe, ExecCacheHash> ExecCache_t;
+static ExecCache_t gExecCache;
+static Mutex gExecCacheMutex;
+
+// registered factories change the outcome of resolutions
+static inline void ClearExecCache()
+{
+    LockGuard lock(gExecCacheMutex);
+    gExecCache.clear();
+}
+
+} // unnamed namespace
+
+//----------------------------------------------------------------------------
+static CPyCppyy::Executor* CreateExecutorForType(
+    Cppyy::TCppType_t type, CPyCppyy::cdims_t dims, ExecRecipe& recipe)
 {
 // The matching of the fulltype to an executor factory goes through up to 4 levels:
 //   1) full, qualified match
@@ -924,9 +1074,10 @@ CPyCppyy::Executor* CPyCppyy::CreateExecutor(Cppyy::TCppType_t type, cdims_t dim
     if (fullType.size() >= 2 && fullType.compare(fullType.size() - 2, 2, " &") == 0)
         fullType = fullType.substr(0, fullType.size() - 2) + "&";
 
-    ExecFactories_t::iterator h = gExecFactories.find(fullType);
-    if (h != gExecFactories.end())
-        return (h->second)(dims);
+    const ExecFactories_t& factories = gExecFactories.Read();
+    ExecFactories_t::const_iterator h = factories.find(fullType);
+    if (h != factories.end())
+        return recipe.Factory(h->second, dims);
 
 // resolve typedefs etc.
     Cppyy::TCppType_t resolvedType = Cppyy::ResolveType(type);
@@ -948,9 +1099,9 @@ CPyCppyy::Executor* CPyCppyy::CreateExecutor(Cppyy::TCppType_t type, cdims_t dim
 
 // a full, qualified matching executor is preferred
     if (resolvedTypeStr != fullType) {
-         h = gExecFactories.find(resolvedTypeStr);
-         if (h != gExecFactories.end())
-              return (h->second)(dims);
+         h = factories.find(resolvedTypeStr);
+         if (h != factories.end())
+              return recipe.Factory(h->second, dims);
     }
 
 //-- nothing? ok, collect information about the type and possible qualifiers/decorators
@@ -961,58 +1112,48 @@ CPyCppyy::Executor* CPyCppyy::CreateExecutor(Cppyy::TCppType_t type, cdims_t dim
     const std::string compounded = cpd.empty() ? realTypeStr : realTypeStr + cpd;
 
 // accept unqualified type (as python does not know about qualifiers)
-    h = gExecFactories.find(compounded);
-    if (h != gExecFactories.end())
-        return (h->second)(dims);
+    h = factories.find(compounded);
+    if (h != factories.end())
+        return recipe.Factory(h->second, dims);
 
 // drop const, as that is mostly meaningless to python (with the exception
 // of c-strings, but those are specialized in the converter map)
     if (isConst) {
         realTypeStr = TypeManip::remove_const(realTypeStr);
-        h = gExecFactories.find(compounded);
-        if (h != gExecFactories.end())
-            return (h->second)(dims);
+        h = factories.find(compounded);
+        if (h != factories.end())
+            return recipe.Factory(h->second, dims);
     }
 
 // simple array types
     if (!cpd.empty() && (std::string::size_type)std::count(cpd.begin(), cpd.end(), '*') == cpd.size()) {
-        h = gExecFactories.find(realTypeStr + " ptr");
-        if (h != gExecFactories.end())
-            return (h->second)((!dims || dims.ndim() < (dim_t)cpd.size()) ? dims_t(cpd.size()) : dims);
+        h = factories.find(realTypeStr + " ptr");
+        if (h != factories.end())
+            return recipe.Factory(h->second, (!dims || dims.ndim() < (dim_t)cpd.size()) ? dims_t(cpd.size()) : dims);
     }
 
 //-- still nothing? try pointer instead of array (for builtins)
     if (cpd == "[]") {
-        h = gExecFactories.find(realTypeStr + "*");
-        if (h != gExecFactories.end())
-            return (h->second)(dims);
+        h = factories.find(realTypeStr + "*");
+        if (h != factories.end())
+            return recipe.Factory(h->second, dims);
     }
 
 // C++ classes and special cases
     Executor* result = 0;
     if (Cppyy::IsClassType(realType)) {
         Cppyy::TCppScope_t klass = Cppyy::GetScopeFromType(realType);
-        if (resolvedTypeStr.find("iterator") != std::string::npos || gIteratorTypes.find(fullType) != gIteratorTypes.end()) {
-            if (cpd == "")
-                return new IteratorExecutor(klass);
-        }
-
-        if (cpd == "")
-            result = new InstanceExecutor(klass);
-        else if (cpd == "&")
-            result = new InstanceRefExecutor(klass);
-        else if (cpd == "**" || cpd == "*[]" || cpd == "&*")
-            result = new InstancePtrPtrExecutor(klass);
-        else if (cpd == "*&")
-            result = new InstancePtrRefExecutor(klass);
-        else if (cpd == "[]") {
-            Py_ssize_t asize = TypeManip::array_size(resolvedTypeStr);
-            if (0 < asize)
-                result = new InstanceArrayExecutor(klass, asize);
-            else
-                result = new InstancePtrRefExecutor(klass);
-        } else
-            result = new InstancePtrExecutor(klass);
+        bool isIterator = resolvedTypeStr.find("iterator") != std::string::npos ||
+            gIteratorTypes.find(fullType) != gIteratorTypes.end();
+        Py_ssize_t asize = cpd == "[]" ? TypeManip::array_size(resolvedTypeStr) : 0;
+        result = selectInstanceExec(klass, cpd, asize, isIterator);
+
+        recipe.fKind       = ExecRecipe::kInstance;
+        recipe.fClass      = klass;
+        recipe.fCpd        = cpd;
+        recipe.fFullType   = fullType;
+        recipe.fASize      = asize;
+        recipe.fIsIterator = isIterator;
     } else if (realTypeStr.find("(*)") != std::string::npos ||
             (realTypeStr.find("::*)") != std::string::npos)) {
         // this is a function pointer
@@ -1024,16 +1165,46 @@ CPyCppyy::Executor* CPyCppyy::CreateExecutor(Cppyy::TCppType_t type, cdims_t dim
         realTypeStr.substr(0, pos1), realTypeStr.substr(pos2+2, pos3-pos2-1));
     } else {
     // unknown: void* may work ("user knows best"), void will fail on use of return value
-        h = (cpd == "") ? gExecFactories.find("void") : gExecFactories.find("void ptr");
+        h = (cpd == "") ? factories.find("void") : factories.find("void ptr");
     }
 
-    if (!result && h != gExecFactories.end())
+    if (!result && h != factories.end())
     // executor factory available, use it to create executor
         result = (h->second)(dims);
 
    return result;                  // may still be null
 }
 
+//----------------------------------------------------------------------------
+CPyCppyy::Executor* CPyCppyy::CreateExecutor(Cppyy::TCppType_t type, cdims_t dims)
+{
+// The resolution of the type to an executor is string-based and costly, so it's done
+// once per distinct type and dimensions, with the outcome replayed after.
+    ExecCacheKey_t key{type, dims};
+    ExecRecipe recipe;
+    {
+        LockGuard lock(gExecCacheMutex);
+        auto c = gExecCache.find(key);
+        if (c != gExecCache.end())
+            recipe = c->second;
+    }
+
+    if (recipe.fKind != ExecRecipe::kNone) {
+        Executor* result = recipe.Replay();
+        if (result)
+            return result;
+        recipe = ExecRecipe{};
+    }
+
+    Executor* result = CreateExecutorForType(type, dims, recipe);
+    if (result && recipe.fKind != ExecRecipe::kNone) {
+        LockGuard lock(gExecCacheMutex);
+        gExecCache.emplace(std::move(key), std::move(recipe));
+    }
+
+    return result;
+}
+
 //----------------------------------------------------------------------------
 CPYCPPYY_EXPORT
 void CPyCppyy::DestroyExecutor(Executor* p)
@@ -1047,12 +1218,11 @@ CPYCPPYY_EXPORT
 bool CPyCppyy::RegisterExecutor(const std::string& name, ef_t fac)
 {
 // register a custom executor
-    auto f = gExecFactories.find(name);
-    if (f != gExecFactories.end())
-        return false;
-
-    gExecFactories[name] = fac;
-    return true;
+    bool added = gExecFactories.Update([&](ExecFactories_t& factories) {
+        return factories.emplace(name, fac).second;
+    });
+    if (added) ClearExecCache();
+    return added;
 }
 
 //----------------------------------------------------------------------------
@@ -1060,16 +1230,19 @@ CPYCPPYY_EXPORT
 bool CPyCppyy::RegisterExecutorAlias(const std::string& name, const std::string& target)
 {
 // register a custom executor that is a reference to an existing converter
-    auto f = gExecFactories.find(name);
-    if (f != gExecFactories.end())
-        return false;
+    bool added = gExecFactories.Update([&](ExecFactories_t& factories) {
+        if (factories.find(name) != factories.end())
+            return false;
 
-    auto t = gExecFactories.find(target);
-    if (t == gExecFactories.end())
-        return false;
+        auto t = factories.find(target);
+        if (t == factories.end())
+            return false;
 
-    gExecFactories[name] = t->second;
-    return true;
+        factories[name] = t->second;
+        return true;
+    });
+    if (added) ClearExecCache();
+    return added;
 }
 
 //----------------------------------------------------------------------------
@@ -1077,12 +1250,37 @@ CPYCPPYY_EXPORT
 bool CPyCppyy::UnregisterExecutor(const std::string& name)
 {
 // remove a custom executor
-    auto f = gExecFactories.find(name);
-    if (f != gExecFactories.end()) {
-        gExecFactories.erase(f);
-        return true;
-    }
-    return false;
+    bool removed = gExecFactories.Update([&](ExecFactories_t& factories) {
+        return factories.erase(name) != 0;
+    });
+    if (removed) ClearExecCache();
+    return removed;
+}
+
+//----------------------------------------------------------------------------
+CPyCppyy::TypedExecute_t CPyCppyy::GetTypedExecute(Executor* exec)
+{
+// only the exact builtin executors qualify, as derived or custom executors may do
+// their own boxing
+    if (!exec)
+        return nullptr;
+
+    const std::type_info& ti = typeid(*exec);
+    if (ti == typeid(VoidExecutor))     return &ExecuteBuiltin<void>;
+    if (ti == typeid(BoolExecutor))     return &ExecuteBuiltin<bool>;
+    if (ti == typeid(ShortExecutor))    return &ExecuteBuiltin<short>;
+    if (ti == typeid(IntExecutor))      return &ExecuteBuiltin<int>;
+    if (ti == typeid(LongExecutor))     return &ExecuteBuiltin<long>;
+    if (ti == typeid(LongLongExecutor)) return &ExecuteBuiltin<PY_LONG_LONG>;
+    if (ti == typeid(FloatExecutor))    return &ExecuteBuiltin<float>;
+    if (ti == typeid(DoubleExecutor))   return &ExecuteBuiltin<double>;
+    return nullptr;
+}
+
+//----------------------------------------------------------------------------
+bool CPyCppyy::TouchesPython(Executor* exec)
+{
+    return (bool)dynamic_cast<PyObjectExecutor*>(exec);
 }
 
 //----------------------------------------------------------------------------
@@ -1114,7 +1312,7 @@ struct InitExecFactories_t {
 public:
     InitExecFactories_t() {
     // load all executor factories in the global map 'gExecFactories'
-        CPyCppyy::ExecFactories_t& gf = gExecFactories;
+        CPyCppyy::ExecFactories_t& gf = gExecFactories.Unsynchronized();
 
     // factories for built-ins
         gf["bool"] =                        (ef_t)+[](cdims_t) { static BoolExecutor e{};          return &e; };
@@ -43,6 +43,14 @@ CPYCPPYY_EXPORT bool RegisterExecutor(const std::string& name, ef_t fac);
 CPYCPPYY_EXPORT bool RegisterExecutorAlias(const std::string& name, const std::string& target);
 CPYCPPYY_EXPORT bool UnregisterExecutor(const std::string& name);
 
+// call and box the result as the builtin executors do, without the virtual Execute();
+// returns nullptr if the executor is not one of these
+typedef PyObject* (*TypedExecute_t)(Cppyy::TCppMethod_t, Cppyy::TCppObject_t, CallContext*);
+TypedExecute_t GetTypedExecute(Executor*);
+
+// whether the C++ side handles Python objects for the result (PyObject* returns)
+bool TouchesPython(Executor*);
+
 // helper for the actual call
 CPYCPPYY_EXPORT void* CallVoidP(Cppyy::TCppMethod_t, Cppyy::TCppObject_t, CallContext*);
 
@@ -3,12 +3,16 @@
 #include "CPyCppyy.h"
 #include "MemoryRegulator.h"
 #include "CPPInstance.h"
+#include "CPPScope.h"
 #include "ProxyWrappers.h"
+#include "Synchronization.h"
 
 // Standard
 #include <assert.h>
 #include <string.h>
 #include <iostream>
+#include <unordered_map>
+#include <vector>
 
 
 //= pseudo-None type for masking out objects on the python side ===============
@@ -75,10 +79,201 @@ struct InitCPyCppyy_NoneType_t {
 
 } // unnamed namespace
 
+//- process-wide registry of tracked objects ----------------------------------
+// Open-addressing table with linear probing, keyed on (C++ address, C++ class) and
+// holding the proxy of each tracked object inline, so that lookups touch contiguous
+// memory rather than separately allocated hash nodes. Erasing shifts the following
+// entries of the probe run back, which leaves no tombstones. A bitmap with one bit per
+// hash bucket (8 per slot) sits in front, so that lookups of addresses that were never
+// registered mostly return without probing the table. On free-threaded builds, the
+// registry is split into independently locked shards.
+#ifndef CPYCPPYY_REGISTRY_SHARDS
+#ifdef Py_GIL_DISABLED
+#define CPYCPPYY_REGISTRY_SHARDS 16
+#else
+#define CPYCPPYY_REGISTRY_SHARDS 1
+#endif
+#endif
+
+namespace {
+
+using CPyCppyy::CPPInstance;
+
+class ObjectRegistry {
+public:
+    ObjectRegistry() : fMask(0), fSize(0), fFilterMask(0), fStale(0) {}
+    ObjectRegistry(const ObjectRegistry&) = delete;
+    ObjectRegistry& operator=(const ObjectRegistry&) = delete;
+
+    static size_t Hash(void* address, void* klass) {
+        uint64_t h = (uint64_t)(uintptr_t)address ^ ((uint64_t)(uintptr_t)klass * 0x9E3779B97F4A7C15ull);
+        h ^= h >> 29; h *= 0xBF58476D1CE4E5B9ull; h ^= h >> 32;
+        return (size_t)h;
+    }
+
+    static ObjectRegistry& Get(size_t hash) {
+    // never deleted, as proxies may be unregistered during shutdown
+        static ObjectRegistry* sShards = new ObjectRegistry[CPYCPPYY_REGISTRY_SHARDS];
+        return sShards[(hash >> 48) % CPYCPPYY_REGISTRY_SHARDS];
+    }
+
+    CPyCppyy::Mutex& GetLock() { return fLock; }
+
+// proxy registered for (address, klass), or nullptr
+    CPPInstance* Find(size_t hash, void* address, void* klass) const {
+        if (!MayContain(hash))
+            return nullptr;
+        for (size_t i = hash & fMask; fSlots[i].fAddress; i = (i+1) & fMask) {
+            if (fSlots[i].fAddress == address && fSlots[i].fClass == klass)
+                return fSlots[i].fObject;
+        }
+        return nullptr;
+    }
+
+// register pyobj for (address, klass); returns the proxy it replaces, if any
+    CPPInstance* Insert(size_t hash, void* address, void* klass, CPPInstance* pyobj) {
+        if ((fSize+1)*4 > fSlots.size()*3)
+            Resize(fSlots.empty() ? kMinCapacity : fSlots.size()*2);
+
+        size_t i = hash & fMask;
+        for (; fSlots[i].fAddress; i = (i+1) & fMask) {
+            if (fSlots[i].fAddress == address && fSlots[i].fClass == klass) {
+                CPPInstance* old = fSlots[i].fObject;
+                fSlots[i].fObject = pyobj;
+                return old;
+            }
+        }
+
+        fSlots[i] = Slot{address, klass, pyobj};
+        fSize += 1;
+        SetFilterBit(hash);
+        return nullptr;
+    }
+
+// remove the entry for (address, klass); returns its proxy, or nullptr if not found
+    CPPInstance* Erase(size_t hash, void* address, void* klass) {
+        if (!MayContain(hash))
+            return nullptr;
+
+        size_t i = hash & fMask;
+        for (; fSlots[i].fAddress; i = (i+1) & fMask) {
+            if (fSlots[i].fAddress == address && fSlots[i].fClass == klass)
+                break;
+        }
+        if (!fSlots[i].fAddress)
+            return nullptr;
+
+        CPPInstance* old = fSlots[i].fObject;
+
+    // close the hole: move back every later entry of the run whose home slot does not
+    // lie cyclically in (hole, entry]
+        for (size_t j = (i+1) & fMask; fSlots[j].fAddress; j = (j+1) & fMask) {
+            size_t home = Hash(fSlots[j].fAddress, fSlots[j].fClass) & fMask;
+            if (((j - home) & fMask) >= ((j - i) & fMask)) {
+                fSlots[i] = fSlots[j];
+                i = j;
+            }
+        }
+        fSlots[i] = Slot{};
+        fSize -= 1;
+
+    // bits can not be cleared individually, so rebuild once enough of them went stale
+        if (kMinCapacity < fSlots.size() && fSize*8 < fSlots.size())
+            Resize(fSlots.size()/2);
+        else if (fSlots.size() < ++fStale*2)
+            RebuildFilter();
+
+        return old;
+    }
+
+private:
+    struct Slot {
+        void*        fAddress;      // nullptr if empty
+        void*        fClass;
+        CPPInstance* fObject;
+    };
+
+    bool MayContain(size_t hash) const {
+        if (!fSize)
+            return false;
+        size_t bit = (hash >> 16) & fFilterMask;
+        return fFilter[bit >> 6] & ((uint64_t)1 << (bit & 63));
+    }
+
+    void SetFilterBit(size_t hash) {
+        size_t bit = (hash >> 16) & fFilterMask;
+        fFilter[bit >> 6] |= (uint64_t)1 << (bit & 63);
+    }
+
+    void RebuildFilter() {
+        fFilter.assign(fSlots.size()/8, 0);
+        fFilterMask = fSlots.size()*8-1;
+        for (const auto& slot : fSlots) {
+            if (slot.fAddress) SetFilterBit(Hash(slot.fAddress, slot.fClass));
+        }
+        fStale = 0;
+    }
+
+    void Resize(size_t capacity) {
+        std::vector<Slot> old;
+        old.swap(fSlots);
+        fSlots.resize(capacity);
+        fMask = capacity-1;
+        for (const auto& slot : old) {
+            if (!slot.fAddress) continue;
+            size_t i = Hash(slot.fAddress, slot.fClass) & fMask;
+            while (fSlots[i].fAddress) i = (i+1) & fMask;
+            fSlots[i] = slot;
+        }
+        RebuildFilter();
+    }
+
+    static const size_t kMinCapacity = 64;
+
+    std::vector<Slot>     fSlots;
+    size_t                fMask;
+    size_t                fSize;
+    std::vector<uint64_t> fFilter;
+    size_t                fFilterMask;   // in bits
+    size_t                fStale;        // erasures since the filter was rebuilt
+    CPyCppyy::Mutex       fLock;
+};
+
+inline void* RegistryClass(PyObject* pyclass)
+{
+// Python-side derived classes share the C++ class of their base for tracking
+    return ((CPyCppyy::CPPClass*)pyclass)->fCppType.data;
+}
+
+} // unnamed namespace
+
+//-----------------------------------------------------------------------------
+static inline bool TryIncRef(PyObject* pyobj)
+{
+// on free-threaded builds, a tracked object may be in the process of being deallocated
+// by another thread, which will remove it from the table once it has the lock
+#if defined(Py_GIL_DISABLED) && PY_VERSION_HEX >= 0x030e0000
+    return PyUnstable_TryIncRef(pyobj);
+#elif defined(Py_GIL_DISABLED)
+// 3.13t has no PyUnstable_TryIncRef and its refcount reaches zero before the entry can
+// be erased, so a reference taken here could resurrect a dying proxy: refuse the lookup
+// instead (a new proxy is created, i.e. object identity is not preserved on 3.13t)
+    (void)pyobj;
+    return false;
+#else
+    Py_INCREF(pyobj);
+    return true;
+#endif
+}
+
 // Memory regulation hooks
 CPyCppyy::MemHook_t CPyCppyy::MemoryRegulator::registerHook   = nullptr;
 CPyCppyy::MemHook_t CPyCppyy::MemoryRegulator::unregisterHook = nullptr;
 
+// Explicit identity tracking policies, by class or namespace
+static CPyCppyy::Mutex gPolicyMutex;
+static std::unordered_map<Cppyy::TCppScope_t, bool> gTrackingPolicies;
+
 
 //- ctor/dtor ----------------------------------------------------------------
 CPyCppyy::MemoryRegulator::MemoryRegulator()
@@ -96,28 +291,18 @@ bool CPyCppyy::MemoryRegulator::RecursiveRemove(
     if (!cppobj)
         return false;
 
-    PyObject* pyscope = GetScopeProxy(klass);
-    if (!CPPScope_Check(pyscope)) {
-        Py_XDECREF(pyscope);
-        return false;
-    }
-
-    CppToPyMap_t* cppobjs = ((CPPClass*)pyscope)->fImp.fCppObjects;
-    if (!cppobjs) {       // table may have been deleted on shutdown
-        Py_DECREF(pyscope);
-        return false;
+// see whether we're tracking this object, and if so, erase it from tracking
+    size_t hash = ObjectRegistry::Hash(cppobj.data, klass.data);
+    ObjectRegistry& registry = ObjectRegistry::Get(hash);
+    CPPInstance* pyobj = nullptr;
+    {
+        LockGuard lock(registry.GetLock());
+        pyobj = registry.Erase(hash, cppobj.data, klass.data);
+        if (pyobj)
+            pyobj->fFlags &= ~CPPInstance::kIsRegulated;
     }
 
-// see whether we're tracking this object
-    CppToPyMap_t::iterator ppo = cppobjs->find(cppobj);
-
-    if (ppo != cppobjs->end()) {
-    // get the tracked object
-        CPPInstance* pyobj = (CPPInstance*)ppo->second;
-
-    // erase the object from tracking
-        pyobj->fFlags &= ~CPPInstance::kIsRegulated;
-        cppobjs->erase(ppo);
+    if (pyobj) {
 
     // nullify the object
         if (!CPyCppyy_NoneType.tp_traverse) {
@@ -135,7 +320,6 @@ bool CPyCppyy::MemoryRegulator::RecursiveRemove(
                       << Py_TYPE(pyobj)->tp_name << std::endl;
 
         // drop object and leave before too much damage is done
-            Py_DECREF(pyscope);
             return false;
         }
 
@@ -154,12 +338,10 @@ bool CPyCppyy::MemoryRegulator::RecursiveRemove(
         Py_DECREF(Py_TYPE(pyobj));
         ((PyObject*)pyobj)->ob_type = &CPyCppyy_NoneType;
 
-        Py_DECREF(pyscope);
         return true;
     }
 
 // unregulated cppobj
-    Py_DECREF(pyscope);
     return false;
 }
 
@@ -171,22 +353,27 @@ bool CPyCppyy::MemoryRegulator::RegisterPyObject(
     if (!(pyobj && cppobj))
         return false;
 
+    if (((CPPClass*)Py_TYPE(pyobj))->fFlags & CPPScope::kNoMemReg)
+        return false;
+
     if (registerHook) {
         auto res = registerHook(cppobj, pyobj->ObjectIsA(false));
         if (!res.second) return res.first;
     }
 
-    CppToPyMap_t* cppobjs = ((CPPClass*)Py_TYPE(pyobj))->fImp.fCppObjects;
-    if (!cppobjs)
-        return false;
+#if defined(Py_GIL_DISABLED) && PY_VERSION_HEX >= 0x030e0000
+    PyUnstable_EnableTryIncRef((PyObject*)pyobj);
+#endif
 
 // if an address was already associated with a different object, then stop following
 // the old and force insert the new proxy for following
-    const auto& res = cppobjs->insert(std::make_pair(cppobj, (PyObject*)pyobj));
-    if (!res.second) {
-        ((CPPInstance*)res.first->second)->fFlags &= ~CPPInstance::kIsRegulated;
-        (*cppobjs)[cppobj] = (PyObject*)pyobj;
-    }
+    void* klass = RegistryClass((PyObject*)Py_TYPE(pyobj));
+    size_t hash = ObjectRegistry::Hash(cppobj.data, klass);
+    ObjectRegistry& registry = ObjectRegistry::Get(hash);
+    LockGuard lock(registry.GetLock());
+    CPPInstance* old = registry.Insert(hash, cppobj.data, klass, pyobj);
+    if (old && old != pyobj)
+        old->fFlags &= ~CPPInstance::kIsRegulated;
 
     pyobj->fFlags |= CPPInstance::kIsRegulated;
     return true;
@@ -208,12 +395,12 @@ bool CPyCppyy::MemoryRegulator::UnregisterPyObject(CPPInstance* pyobj, PyObject*
         if (!res.second) return res.first;
     }
 
-    CppToPyMap_t* cppobjs = ((CPPClass*)pyclass)->fImp.fCppObjects;
-    if (!cppobjs)
-        return false;
-
 // erase if tracked
-    if (cppobjs->erase(cppobj)) {
+    void* klass = RegistryClass(pyclass);
+    size_t hash = ObjectRegistry::Hash(cppobj.data, klass);
+    ObjectRegistry& registry = ObjectRegistry::Get(hash);
+    LockGuard lock(registry.GetLock());
+    if (registry.Erase(hash, cppobj.data, klass)) {
         pyobj->fFlags &= ~CPPInstance::kIsRegulated;
         return true;
     }
@@ -225,22 +412,84 @@ bool CPyCppyy::MemoryRegulator::UnregisterPyObject(CPPInstance* pyobj, PyObject*
 PyObject* CPyCppyy::MemoryRegulator::RetrievePyObject(Cppyy::TCppObject_t cppobj, PyObject* pyclass)
 {
 // lookup to see if a C++ address is already known, return old proxy if tracked
-    if (!(cppobj && pyclass))
+    if (!(cppobj && pyclass) || (((CPPClass*)pyclass)->fFlags & CPPScope::kNoMemReg))
        return nullptr;
 
-    CppToPyMap_t* cppobjs = ((CPPClass*)pyclass)->fImp.fCppObjects;
-    if (!cppobjs)
-        return nullptr;
+    void* klass = RegistryClass(pyclass);
+    size_t hash = ObjectRegistry::Hash(cppobj.data, klass);
+    ObjectRegistry& registry = ObjectRegistry::Get(hash);
+    LockGuard lock(registry.GetLock());
+    PyObject* pyobj = (PyObject*)registry.Find(hash, cppobj.data, klass);
+    if (pyobj && TryIncRef(pyobj))
+        return pyobj;
 
-    CppToPyMap_t::iterator ppo = cppobjs->find(cppobj);
-    if (ppo != cppobjs->end()) {
-        Py_INCREF(ppo->second);
-        return ppo->second;
+    return nullptr;
+}
+
+
+//-----------------------------------------------------------------------------
+static void ApplyTrackingPolicy(CPyCppyy::CPPScope* klass)
+{
+// refresh the tracking flag of an existing class proxy and of the Python-side classes
+// deriving from it, as those are not in the proxy map and only set the flag in pt_new
+    if (CPyCppyy::MemoryRegulator::IsTracked(klass->fCppType))
+        klass->fFlags &= ~CPyCppyy::CPPScope::kNoMemReg;
+    else
+        klass->fFlags |= CPyCppyy::CPPScope::kNoMemReg;
+
+    PyObject* subclasses = PyObject_CallMethod((PyObject*)klass, (char*)"__subclasses__", nullptr);
+    if (!subclasses) {
+        PyErr_Clear();
+        return;
     }
 
-    return nullptr;
+    for (Py_ssize_t i = 0; i < PyList_GET_SIZE(subclasses); ++i) {
+        PyObject* sub = PyList_GET_ITEM(subclasses, i);
+        if (CPyCppyy::CPPScope_Check(sub) && (((CPyCppyy::CPPScope*)sub)->fFlags & CPyCppyy::CPPScope::kIsPython))
+            ApplyTrackingPolicy((CPyCppyy::CPPScope*)sub);
+    }
+    Py_DECREF(subclasses);
 }
 
+//-----------------------------------------------------------------------------
+void CPyCppyy::MemoryRegulator::SetTrackingPolicy(Cppyy::TCppScope_t scope, bool track)
+{
+// Set the identity tracking policy of a class or namespace, and apply it to the classes
+// that already have a proxy; new ones pick it up on creation through IsTracked()
+    {
+        LockGuard lock(gPolicyMutex);
+        gTrackingPolicies[scope] = track;
+    }
+
+    for (PyObject* pyclass : GetScopeProxies()) {
+        CPPScope* klass = (CPPScope*)pyclass;
+        if (CPPScope_Check(pyclass) && !(klass->fFlags & CPPScope::kIsNamespace))
+            ApplyTrackingPolicy(klass);
+        Py_DECREF(pyclass);
+    }
+}
+
+//-----------------------------------------------------------------------------
+bool CPyCppyy::MemoryRegulator::IsTracked(Cppyy::TCppScope_t klass)
+{
+// Determine the policy for klass: closest explicit setting, walking outwards
+    LockGuard lock(gPolicyMutex);
+    if (gTrackingPolicies.empty())
+        return true;
+
+    Cppyy::TCppScope_t scope = klass;
+    while (scope) {
+        auto p = gTrackingPolicies.find(scope);
+        if (p != gTrackingPolicies.end())
+            return p->second;
+        Cppyy::TCppScope_t parent = Cppyy::GetParentScope(scope);
+        if (parent == scope)
+            break;
+        scope = parent;
+    }
+
+    return true;
+}
 
 //-----------------------------------------------------------------------------
 void CPyCppyy::MemoryRegulator::SetRegisterHook(MemHook_t h) {
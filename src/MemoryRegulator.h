@@ -33,6 +33,11 @@ public:
 // new reference to python object matching cppobj, or 0 on failure
     static PyObject* RetrievePyObject(Cppyy::TCppObject_t cppobj, PyObject* pyclass);
 
+// identity tracking policy of a class, or of all classes in a namespace; the nearest
+// explicit setting of the class or its enclosing scopes applies (default: tracked)
+    static void SetTrackingPolicy(Cppyy::TCppScope_t scope, bool track);
+    static bool IsTracked(Cppyy::TCppScope_t klass);
+
 // set hooks for custom memory regulation
     static void SetRegisterHook(MemHook_t h);
     static void SetUnregisterHook(MemHook_t h);
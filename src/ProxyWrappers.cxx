@@ -16,6 +16,7 @@
 #include "MemoryRegulator.h"
 #include "PyStrings.h"
 #include "Pythonize.h"
+#include "Synchronization.h"
 #include "TemplateProxy.h"
 #include "TupleOfInstances.h"
 #include "TypeManip.h"
@@ -37,9 +38,19 @@ namespace CPyCppyy {
     extern std::unordered_set<Cppyy::TCppScope_t> gPinnedTypes;
 }
 
-// to prevent having to walk scopes, track python classes by C++ class
+// to prevent having to walk scopes, track python classes by C++ class; the table is
+// sharded by scope, so that lookups from different threads rarely share a lock
 typedef std::unordered_map<Cppyy::TCppScope_t, PyObject*> PyClassMap_t;
-static PyClassMap_t gPyClasses;
+static struct PyClassShard_t {
+    CPyCppyy::Mutex fMutex;
+    PyClassMap_t    fClasses;
+} gPyClasses[16];
+
+static inline PyClassShard_t& GetPyClassShard(Cppyy::TCppScope_t scope)
+{
+    size_t h = std::hash<Cppyy::TCppScope_t>{}(scope);
+    return gPyClasses[(h ^ (h >> 4) ^ (h >> 8)) & 15];
+}
 
 
 //- helpers --------------------------------------------------------------------
@@ -506,8 +517,10 @@ static PyObject* BuildCppClassBases(Cppyy::TCppScope_t klass)
 PyObject* CPyCppyy::GetScopeProxy(Cppyy::TCppScope_t scope)
 {
 // Retrieve scope proxy from the known ones.
-    PyClassMap_t::iterator pci = gPyClasses.find(scope);
-    if (pci != gPyClasses.end()) {
+    PyClassShard_t& shard = GetPyClassShard(scope);
+    LockGuard lock(shard.fMutex);
+    PyClassMap_t::iterator pci = shard.fClasses.find(scope);
+    if (pci != shard.fClasses.end()) {
         PyObject* pyclass = CPyCppyy_GetWeakRef(pci->second);
         if (pyclass)
             return pyclass;
@@ -515,6 +528,23 @@ PyObject* CPyCppyy::GetScopeProxy(Cppyy::TCppScope_t scope)
 
     return nullptr;
 }
+
+//----------------------------------------------------------------------------
+std::vector<PyObject*> CPyCppyy::GetScopeProxies()
+{
+// Retrieve all live scope proxies, as new references.
+    std::vector<PyObject*> result;
+    for (auto& shard : gPyClasses) {
+        LockGuard lock(shard.fMutex);
+        for (const auto& pci : shard.fClasses) {
+            PyObject* pyclass = CPyCppyy_GetWeakRef(pci.second);
+            if (pyclass)
+                result.push_back(pyclass);
+        }
+    }
+    return result;
+}
+
 namespace CPyCppyy {
 PyObject *CppType_To_PyObject(Cppyy::TCppType_t type, std::string name, Cppyy::TCppScope_t parent_scope, PyObject *parent) {
     Cppyy::TCppType_t resolved_type = Cppyy::ResolveType(type);
@@ -698,7 +728,12 @@ PyObject* CPyCppyy::CreateScopeProxy(Cppyy::TCppScope_t scope, PyObject* parent,
 
     // store a ref from cppyy scope id to new python class
         if (pyscope && !(((CPPScope*)pyscope)->fFlags & CPPScope::kIsInComplete)) {
-            gPyClasses[scope] = PyWeakref_NewRef(pyscope, nullptr);
+            PyObject* pyref = PyWeakref_NewRef(pyscope, nullptr);
+            {
+                PyClassShard_t& shard = GetPyClassShard(scope);
+                LockGuard lock(shard.fMutex);
+                shard.fClasses[scope] = pyref;
+            }
 
             if (!(((CPPScope*)pyscope)->fFlags & CPPScope::kIsNamespace)) {
             // add python-style features to classes only
@@ -896,11 +931,17 @@ PyObject* CPyCppyy::BindCppObjectNoCast(Cppyy::TCppObject_t address,
         }
     }
 
-// instantiate an object of this class
-    PyObject* args = PyTuple_New(0);
-    CPPInstance* pyobj =
-        (CPPInstance*)((PyTypeObject*)pyclass)->tp_new((PyTypeObject*)pyclass, args, nullptr);
-    Py_DECREF(args);
+// instantiate an object of this class; args and kwds are not used by CPPInstance's
+// tp_new, so only a Python-side override of __new__ needs the (empty) args tuple
+    PyTypeObject* pytype = (PyTypeObject*)pyclass;
+    CPPInstance* pyobj = nullptr;
+    if (pytype->tp_new == CPPInstance_Type.tp_new)
+        pyobj = (CPPInstance*)pytype->tp_new(pytype, nullptr, nullptr);
+    else {
+        PyObject* args = PyTuple_New(0);
+        pyobj = (CPPInstance*)pytype->tp_new(pytype, args, nullptr);
+        Py_DECREF(args);
+    }
 
 // bind, register and return if successful
     if (pyobj != 0) { // fill proxy value?
@@ -960,9 +1001,10 @@ PyObject* CPyCppyy::BindCppObject(Cppyy::TCppObject_t address,
                 if (offset != -1) {   // may fail if clActual not fully defined
                     address = (void*)((intptr_t)address.data + offset);
                     klass = clActual;
+                    new_flags |= CPPInstance::kIsActual;
                 }
-            }
-            new_flags |= CPPInstance::kIsActual;
+            } else
+                new_flags |= CPPInstance::kIsActual;
         }
     }
 
@@ -6,12 +6,14 @@
 
 // Standard
 #include <string>
+#include <vector>
 
 
 namespace CPyCppyy {
 
 // construct a Python shadow class for the named C++ class
 PyObject* GetScopeProxy(Cppyy::TCppScope_t);
+std::vector<PyObject*> GetScopeProxies();
 PyObject* CreateScopeProxy(PyObject*, PyObject* args);
 PyObject* CreateScopeProxy(
     const std::string& scope_name, PyObject* parent = nullptr, const unsigned flags = 0);
@@ -44,9 +44,17 @@ public:
 
     virtual int GetArgMatchScore(PyObject* /* args_tuple */) { return INT_MAX; }
 
+// side-effect free pre-check of the arguments of a call (see EArgMatch); kMaybeMatch
+// means that only an actual call can decide
+    virtual int ArgMatch(CPPInstance* /* self */, CPyCppyy_PyArgs_t /* args */,
+        size_t /* nargsf */, PyObject* /* kwds */, CallContext* /* ctxt */) { return kMaybeMatch; }
+
 public:
     virtual PyObject* Call(CPPInstance*& self,
         CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds, CallContext* ctxt = nullptr) = 0;
+
+// (approximate) number of bytes held by this callable, for memory accounting; 0 if unknown
+    virtual size_t GetMemoryUsage() { return 0; }
 };
 
 } // namespace CPyCppyy
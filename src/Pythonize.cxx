@@ -11,6 +11,7 @@
 #include "ProxyWrappers.h"
 #include "PyCallable.h"
 #include "PyStrings.h"
+#include "Synchronization.h"
 #include "TypeManip.h"
 #include "Utility.h"
 
@@ -311,8 +312,118 @@ static ItemGetter* GetGetter(PyObject* args)
     return getter;
 }
 
+static bool GetVectorValueType(PyObject* pyclass, Cppyy::TCppType_t& value_type, Py_ssize_t& stride)
+{
+// Helper; resolved value type and element size of a std::vector, as set on its class.
+    PyObject* vtype = GetAttrDirect(pyclass, PyStrings::gValueTypePtr);
+    PyObject* vsize = vtype ? GetAttrDirect(pyclass, PyStrings::gValueSize) : nullptr;
+    value_type = Cppyy::TCppType_t{};
+    stride = 0;
+    if (vtype && vsize && PyLong_Check(vtype)) {
+        value_type = PyLong_AsVoidPtr(vtype);
+        stride = PyLong_AsSsize_t(vsize);
+    }
+    Py_XDECREF(vsize);
+    Py_XDECREF(vtype);
+    if (!value_type || stride <= 0 || PyErr_Occurred()) {
+        PyErr_Clear();
+        return false;
+    }
+
+// vector<bool> is packed and has no data()
+    return Cppyy::GetTypeAsString(value_type) != "bool";
+}
+
+static void* GetVectorData(PyObject* vec)
+{
+// Helper; start of the contiguous storage of a std::vector, or nullptr if unknown.
+    void* data = nullptr;
+    PyObject* pydata = CallPyObjMethod(vec, "__real_data");
+    if (pydata && Utility::GetBuffer(pydata, '*', 1, data, false) == 0)
+        data = CPPInstance_Check(pydata) ? ((CPPInstance*)pydata)->GetObjectRaw() : nullptr;
+    Py_XDECREF(pydata);
+    if (!data) PyErr_Clear();
+    return data;
+}
+
+static bool ResizeVector(PyObject* vec, Py_ssize_t sz)
+{
+    PyObject* res = PyObject_CallMethod(vec, (char*)"resize", (char*)"n", sz);
+    Py_XDECREF(res);
+    return (bool)res;
+}
+
+static int FillVectorNative(PyObject* vecin, ItemGetter* getter)
+{
+// Fill the vector by resizing it once, then converting the items directly into its
+// data(), for tuples and lists of builtins, strings, or objects stored by-value.
+// Returns 1 if filled, 0 if not applicable (nothing changed), and -1 on error.
+    PyObject* seq = getter->fPyObject;
+    if (!PyTuple_CheckExact(seq) && !PyList_CheckExact(seq))
+        return 0;
+
+    Py_ssize_t nitems = PySequence_Fast_GET_SIZE(seq);
+    if (nitems == 0 || PyTuple_CheckExact(PySequence_Fast_GET_ITEM(seq, 0)) ||
+            PyList_CheckExact(PySequence_Fast_GET_ITEM(seq, 0)))
+        return 0;         // lists of lists (or tuples) are emplace_back'ed
+
+    Cppyy::TCppType_t value_type;
+    Py_ssize_t stride;
+    if (!GetVectorValueType((PyObject*)Py_TYPE(vecin), value_type, stride))
+        return 0;
+
+// pointers are left to push_back for its checks
+    if (Cppyy::IsPointerType(value_type))
+        return 0;
+
+    Converter* cnv = CreateConverter(value_type);
+    if (!cnv)
+        return 0;
+
+    Py_ssize_t oldsz = PySequence_Size(vecin);
+    if (oldsz < 0) {
+        PyErr_Clear();
+        DestroyConverter(cnv);
+        return 0;
+    }
+
+// resizing default constructs the new elements, which are then assigned to
+    if (!ResizeVector(vecin, oldsz+nitems)) {
+        PyErr_Clear();
+        DestroyConverter(cnv);
+        return 0;
+    }
+
+    void* data = GetVectorData(vecin);
+
+    bool fill_ok = (bool)data;
+    for (Py_ssize_t i = 0; fill_ok && i < nitems; ++i) {
+    // the items are revisited on every step, as assignments may run Python code
+        if (PySequence_Fast_GET_SIZE(seq) != nitems) {
+            fill_ok = false;
+            break;
+        }
+        PyObject* item = PySequence_Fast_GET_ITEM(seq, i);
+        Py_INCREF(item);
+        fill_ok = cnv->ToMemory(item, (char*)data + (oldsz+i)*stride);
+        Py_DECREF(item);
+    }
+    DestroyConverter(cnv);
+
+    if (fill_ok)
+        return 1;
+
+// restore the original size and let the generic code handle (or report) the items
+    PyErr_Clear();
+    return ResizeVector(vecin, oldsz) ? 0 : -1;
+}
+
 static bool FillVector(PyObject* vecin, PyObject* args, ItemGetter* getter)
 {
+    int native = FillVectorNative(vecin, getter);
+    if (native != 0)
+        return native == 1;
+
     Py_ssize_t sz = getter->size();
     if (sz < 0)
         return false;
@@ -620,6 +731,59 @@ static PyObject* vector_iter(PyObject* v) {
     return (PyObject*)vi;
 }
 
+template<size_t N>
+static void GatherStrided(char* dst, const char* src, Py_ssize_t n, Py_ssize_t step)
+{
+// copies of a fixed size compile to single (unaligned) loads and stores, without
+// interpreting the bits as any particular type
+    for (Py_ssize_t i = 0; i < n; ++i)
+        memcpy(dst + i*N, src + i*step*N, N);
+}
+
+static int VectorSliceNative(PyObject* self, PyObject* nseq,
+    Py_ssize_t start, Py_ssize_t stop, Py_ssize_t step)
+{
+// Copy a slice as raw memory for element types that allow it: a single memcpy for
+// contiguous slices, a gather loop otherwise. Returns 1 if copied, 0 if not
+// applicable (nseq unchanged), and -1 on error.
+    Cppyy::TCppType_t value_type;
+    Py_ssize_t stride;
+    if (!GetVectorValueType((PyObject*)Py_TYPE(self), value_type, stride))
+        return 0;
+
+    Cppyy::TCppScope_t klass = Cppyy::GetScopeFromType(value_type);
+    if (klass && !Utility::IsTriviallyCopyable(klass))
+        return 0;
+
+    Py_ssize_t n = step > 0 ? (stop-start+step-1)/step : (start-stop-step-1)/(-step);
+    if (start < 0 || n <= 0)
+        return 0;
+
+    if (!ResizeVector(nseq, n)) {
+        PyErr_Clear();
+        return 0;
+    }
+
+    char* src = (char*)GetVectorData(self);
+    char* dst = (char*)GetVectorData(nseq);
+    if (!src || !dst)
+        return ResizeVector(nseq, 0) ? 0 : -1;
+
+    src += start*stride;
+    if (step == 1)
+        memcpy(dst, src, n*stride);
+    else if (stride == sizeof(uint64_t))
+        GatherStrided<sizeof(uint64_t)>(dst, src, n, step);
+    else if (stride == sizeof(uint32_t))
+        GatherStrided<sizeof(uint32_t)>(dst, src, n, step);
+    else {
+        for (Py_ssize_t i = 0; i < n; ++i)
+            memcpy(dst + i*stride, src + i*step*stride, stride);
+    }
+
+    return 1;
+}
+
 PyObject* VectorGetItem(CPPInstance* self, PySliceObject* index)
 {
 // Implement python's __getitem__ for std::vector<>s.
@@ -639,6 +803,12 @@ PyObject* VectorGetItem(CPPInstance* self, PySliceObject* index)
         if (!AdjustSlice(nlen, start, stop, step))
             return nseq;
 
+        int native = nseq ? VectorSliceNative((PyObject*)self, nseq, start, stop, step) : 0;
+        if (native != 0) {
+            if (native < 0) Py_CLEAR(nseq);
+            return nseq;
+        }
+
         const Py_ssize_t sign = step < 0 ? -1 : 1;
         for (Py_ssize_t i = start; i*sign < stop*sign; i += step) {
             PyObject* pyidx = PyInt_FromSsize_t(i);
@@ -655,6 +825,168 @@ PyObject* VectorGetItem(CPPInstance* self, PySliceObject* index)
 }
 
 
+//- direct element access for vectors of builtins -----------------------------
+// data() and size() of a vector, through a compiled accessor per vector class
+typedef void* (*VectorDataFn_t)(void* vec, size_t* size);
+
+struct VectorAccess {
+    VectorDataFn_t fData;         // compiled on first use; nullptr until then
+    Converter*     fConverter;    // nullptr if direct access is not available
+    Py_ssize_t     fStride;
+};
+
+typedef std::unordered_map<PyTypeObject*, VectorAccess> VectorAccessMap_t;
+static RCUTable<VectorAccessMap_t> sVectorAccess;
+
+static VectorDataFn_t CompileVectorData(Cppyy::TCppScope_t klass)
+{
+    static int count = 0;
+    std::ostringstream fname;
+    fname << "vector_data" << ++count;
+
+    const std::string& vecname = Cppyy::GetScopedFinalName(klass);
+    std::ostringstream code;
+    code << "namespace __cppyy_internal { void* " << fname.str() << "(void* v, size_t* sz) {\n"
+         << "  auto& vec = *(" << vecname << "*)v;\n"
+         << "  *sz = vec.size();\n"
+         << "  return (void*)vec.data();\n} }";
+
+    if (!Cppyy::Compile(code.str(), true /* silent */))
+        return nullptr;
+
+    Cppyy::TCppScope_t cis = Cppyy::GetScope("__cppyy_internal");
+    const auto& methods = Cppyy::GetMethodsFromName(cis, fname.str());
+    if (methods.empty())
+        return nullptr;
+    return (VectorDataFn_t)Cppyy::GetFunctionAddress(methods[0], false);
+}
+
+static bool GetVectorAccess(PyObject* self, VectorAccess& va)
+{
+// Helper; direct access information for the exact class of self, if any.
+    PyTypeObject* pytype = Py_TYPE(self);
+    {
+        const VectorAccessMap_t& table = sVectorAccess.Read();
+        auto a = table.find(pytype);
+        if (a == table.end() || !a->second.fConverter)
+            return false;
+        va = a->second;
+    }
+    if (va.fData)
+        return true;
+
+    VectorDataFn_t fn = CompileVectorData(((CPPClass*)pytype)->fCppType);
+    sVectorAccess.Update([&](VectorAccessMap_t& table) {
+        VectorAccess& e = table[pytype];
+        if (fn) e.fData = fn;
+        else    e.fConverter = nullptr;      // no direct access from now on
+        return 0;
+    });
+    va.fData = fn;
+    return (bool)fn;
+}
+
+static char* VectorElement(PyObject* self, const VectorAccess& va, Py_ssize_t idx)
+{
+// Helper; address of element idx (negative counts from the end), or nullptr on error.
+    void* vec = ((CPPInstance*)self)->GetObject();
+    if (!vec) {
+        PyErr_SetString(PyExc_TypeError, "unsubscriptable object");
+        return nullptr;
+    }
+
+    size_t size = 0;
+    char* data = (char*)va.fData(vec, &size);
+    if (idx < 0) idx += (Py_ssize_t)size;
+    if (idx < 0 || (size_t)idx >= size) {
+        PyErr_SetString(PyExc_IndexError, "index out of range");
+        return nullptr;
+    }
+
+    return data + idx*va.fStride;
+}
+
+static PyObject* vector_subscript(PyObject* self, PyObject* key)
+{
+    VectorAccess va;
+    if (PyIndex_Check(key) && GetVectorAccess(self, va)) {
+        Py_ssize_t idx = PyNumber_AsSsize_t(key, PyExc_IndexError);
+        if (idx == -1 && PyErr_Occurred())
+            return nullptr;
+        char* addr = VectorElement(self, va, idx);
+        return addr ? va.fConverter->FromMemory(addr) : nullptr;
+    }
+
+    return VectorGetItem((CPPInstance*)self, (PySliceObject*)key);
+}
+
+static PyObject* vector_item(PyObject* self, Py_ssize_t idx)
+{
+    VectorAccess va;
+    if (GetVectorAccess(self, va)) {
+        char* addr = VectorElement(self, va, idx);
+        return addr ? va.fConverter->FromMemory(addr) : nullptr;
+    }
+
+    PyObject* pyidx = PyLong_FromSsize_t(idx);
+    PyObject* result = VectorGetItem((CPPInstance*)self, (PySliceObject*)pyidx);
+    Py_DECREF(pyidx);
+    return result;
+}
+
+static int vector_ass_subscript(PyObject* self, PyObject* key, PyObject* value)
+{
+    VectorAccess va;
+    if (value && PyIndex_Check(key) && GetVectorAccess(self, va)) {
+        Py_ssize_t idx = PyNumber_AsSsize_t(key, PyExc_IndexError);
+        if (idx == -1 && PyErr_Occurred())
+            return -1;
+        char* addr = VectorElement(self, va, idx);
+        return (addr && va.fConverter->ToMemory(value, addr)) ? 0 : -1;
+    }
+
+// anything else (slices, deletion) is left to the bound methods
+    PyObject* result = value ?
+        PyObject_CallMethodObjArgs(self, PyStrings::gSetItem, key, value, nullptr) :
+        PyObject_CallMethod(self, (char*)"__delitem__", (char*)"O", key);
+    Py_XDECREF(result);
+    return result ? 0 : -1;
+}
+
+static int vector_ass_item(PyObject* self, Py_ssize_t idx, PyObject* value)
+{
+    PyObject* pyidx = PyLong_FromSsize_t(idx);
+    int result = vector_ass_subscript(self, pyidx, value);
+    Py_DECREF(pyidx);
+    return result;
+}
+
+static void InstallVectorAccess(PyObject* pyclass, Cppyy::TCppType_t vtype, size_t typesz)
+{
+// Helper; bypass the bound __getitem__/__setitem__ for vectors of builtins and enums,
+// by reading and writing element memory directly (bounds-checked against size()).
+    if (!vtype || !typesz || Cppyy::IsClassType(vtype) || Cppyy::IsPointerType(vtype))
+        return;
+
+    Converter* cnv = CreateConverter(vtype);
+    if (!cnv)
+        return;
+
+    PyTypeObject* pytype = (PyTypeObject*)pyclass;
+    sVectorAccess.Update([&](VectorAccessMap_t& table) {
+        table[pytype] = VectorAccess{nullptr, cnv, (Py_ssize_t)typesz};
+        return 0;
+    });
+
+    pytype->tp_as_mapping->mp_subscript = (binaryfunc)vector_subscript;
+    pytype->tp_as_sequence->sq_item = (ssizeargfunc)vector_item;
+    if (HasAttrDirect(pyclass, PyStrings::gSetItem)) {
+        pytype->tp_as_mapping->mp_ass_subscript = (objobjargproc)vector_ass_subscript;
+        pytype->tp_as_sequence->sq_ass_item = (ssizeobjargproc)vector_ass_item;
+    }
+}
+
+
 static Cppyy::TCppScope_t sVectorBoolTypeID;
 
 PyObject* VectorBoolGetItem(CPPInstance* self, PyObject* idx)
@@ -1035,6 +1367,177 @@ PyObject* STLSequenceIter(PyObject* self)
     return iter;
 }
 
+//- compiled iteration over associative containers ----------------------------
+// begin() of a map/set type container, returning an owned [begin, end) iterator pair
+typedef void* (*AssocBeginFn_t)(void* container);
+
+struct AssocAccess {
+    AssocBeginFn_t     fBegin;          // compiled on first use; nullptr until then
+    AssocNextFn_t      fNext;
+    AssocFreeFn_t      fFree;
+    bool               fFailed;         // no compiled iteration: use STLSequenceIter
+    Converter*         fKeyConverter;
+    Cppyy::TCppScope_t fKeyKlass;
+    Converter*         fValueConverter;
+    Cppyy::TCppScope_t fValueKlass;
+    Cppyy::TCppScope_t fPairKlass;      // maps only
+};
+
+typedef std::unordered_map<PyTypeObject*, AssocAccess> AssocAccessMap_t;
+static RCUTable<AssocAccessMap_t> sAssocAccess;
+static SharedFlags_t sMapIterTuples{0};
+
+static bool CompileAssocIter(Cppyy::TCppScope_t klass, bool isMap, AssocAccess& aa)
+{
+    static int count = 0;
+    const std::string id = std::to_string(++count);
+
+    const std::string& cname = Cppyy::GetScopedFinalName(klass);
+    std::ostringstream code;
+    code << "namespace __cppyy_internal {\n"
+         << "typedef std::pair<" << cname << "::iterator, " << cname << "::iterator> assoc_state" << id << ";\n"
+         << "void* assoc_begin" << id << "(void* c) {\n"
+         << "  auto& cc = *(" << cname << "*)c;\n"
+         << "  return new assoc_state" << id << "(cc.begin(), cc.end());\n}\n"
+         << "void* assoc_next" << id << "(void* s, void** k, void** v) {\n"
+         << "  auto& st = *(assoc_state" << id << "*)s;\n"
+         << "  if (st.first == st.second) return nullptr;\n"
+         << "  auto& e = *st.first++;\n";
+    if (isMap)
+        code << "  *k = (void*)std::addressof(e.first); *v = (void*)std::addressof(e.second);\n";
+    else
+        code << "  *k = (void*)std::addressof(e); *v = nullptr;\n";
+    code << "  return (void*)std::addressof(e);\n}\n"
+         << "void assoc_free" << id << "(void* s) { delete (assoc_state" << id << "*)s; }\n}";
+
+    if (!Cppyy::Compile(code.str(), true /* silent */))
+        return false;
+
+    Cppyy::TCppScope_t cis = Cppyy::GetScope("__cppyy_internal");
+    void* fns[3] = {nullptr, nullptr, nullptr};
+    const char* names[3] = {"assoc_begin", "assoc_next", "assoc_free"};
+    for (int i = 0; i < 3; ++i) {
+        const auto& methods = Cppyy::GetMethodsFromName(cis, names[i] + id);
+        if (methods.empty() || !(fns[i] = (void*)Cppyy::GetFunctionAddress(methods[0], false)))
+            return false;
+    }
+
+    aa.fBegin = (AssocBeginFn_t)fns[0];
+    aa.fNext  = (AssocNextFn_t)fns[1];
+    aa.fFree  = (AssocFreeFn_t)fns[2];
+    return true;
+}
+
+static PyObject* assoc_iter(PyObject* self)
+{
+// Implement python's __iter__ for std::map/std::set type containers with a single
+// compiled call per step, rather than bound operator!=, operator*, and operator++
+    PyTypeObject* pytype = Py_TYPE(self);
+    AssocAccess aa{};
+    bool found = false;
+    {
+        const AssocAccessMap_t& table = sAssocAccess.Read();
+        auto a = table.find(pytype);
+        if (a != table.end()) {
+            aa = a->second;
+            found = true;
+        }
+    }
+
+    if (found && !aa.fBegin && !aa.fFailed) {
+        bool ok = CompileAssocIter(((CPPClass*)pytype)->fCppType, (bool)aa.fPairKlass, aa);
+        sAssocAccess.Update([&](AssocAccessMap_t& table) {
+            AssocAccess& e = table[pytype];
+            if (ok) { e.fBegin = aa.fBegin; e.fNext = aa.fNext; e.fFree = aa.fFree; }
+            else    e.fFailed = true;       // don't retry
+            return 0;
+        });
+        aa.fFailed = !ok;
+    }
+
+// derived python classes, failed compilation, or no object: take the generic route
+    void* cont = found && !aa.fFailed ? ((CPPInstance*)self)->GetObject() : nullptr;
+    if (!cont)
+        return STLSequenceIter(self);
+
+    associterobject* ai = PyObject_GC_New(associterobject, &AssocIter_Type);
+    if (!ai) return nullptr;
+
+// tell the iterator code to set a life line if this container is a temporary
+    ai->ai_flags = associterobject::kDefault;
+#if PY_VERSION_HEX >= 0x030e0000
+    if (PyUnstable_Object_IsUniqueReferencedTemporary(self) || (((CPPInstance*)self)->fFlags & CPPInstance::kIsValue))
+#else
+    if (Py_REFCNT(self) <= 1 || (((CPPInstance*)self)->fFlags & CPPInstance::kIsValue))
+#endif
+        ai->ai_flags = associterobject::kNeedLifeLine;
+
+    Py_INCREF(self);
+    ai->ai_container       = self;
+    ai->ai_state           = aa.fBegin(cont);
+    ai->ai_next            = aa.fNext;
+    ai->ai_free            = aa.fFree;
+    ai->ai_key_converter   = aa.fKeyConverter;
+    ai->ai_key_klass       = aa.fKeyKlass;
+    ai->ai_value_converter = aa.fValueConverter;
+    ai->ai_value_klass     = aa.fValueKlass;
+    ai->ai_pair_klass      = aa.fPairKlass;
+
+    if (aa.fPairKlass) {
+        ai->ai_flags |= associterobject::kIsMap;
+        if (sMapIterTuples)
+            ai->ai_flags |= associterobject::kAsTuple;
+    }
+
+    PyObject_GC_Track(ai);
+    return (PyObject*)ai;
+}
+
+static bool SelectAssocItem(Cppyy::TCppScope_t scope, const char* tdname,
+    Converter*& cnv, Cppyy::TCppScope_t& klass)
+{
+// Helper; objects are bound by reference, everything else is converted
+    Cppyy::TCppType_t type = Cppyy::ResolveType(Cppyy::GetTypeFromScope(Cppyy::GetNamed(tdname, scope)));
+    if (!type)
+        return false;
+
+    if (Cppyy::IsClassType(type) && !Cppyy::IsPointerType(type)) {
+        klass = Cppyy::GetScopeFromType(type);
+        if (klass) return true;
+    }
+
+    cnv = CreateConverter(type);
+    return (bool)cnv;
+}
+
+static void InstallAssocIter(PyObject* pyclass, Cppyy::TCppScope_t scope, bool isMap)
+{
+// Helper; replace the generic begin()/end() iteration with the compiled one (the
+// compilation itself is deferred until the first iteration).
+    PyTypeObject* pytype = (PyTypeObject*)pyclass;
+
+    AssocAccess aa{};
+    if (isMap) {
+        if (!SelectAssocItem(scope, "key_type", aa.fKeyConverter, aa.fKeyKlass) ||
+                !SelectAssocItem(scope, "mapped_type", aa.fValueConverter, aa.fValueKlass))
+            return;
+        Cppyy::TCppType_t ptype = Cppyy::ResolveType(Cppyy::GetTypeFromScope(Cppyy::GetNamed("value_type", scope)));
+        aa.fPairKlass = ptype ? Cppyy::GetScopeFromType(ptype) : Cppyy::TCppScope_t{};
+        if (!aa.fPairKlass)
+            return;
+    } else if (!SelectAssocItem(scope, "value_type", aa.fKeyConverter, aa.fKeyKlass))
+        return;
+
+    sAssocAccess.Update([&](AssocAccessMap_t& table) {
+        table[pytype] = aa;
+        return 0;
+    });
+
+    Utility::AddToClass(pyclass, "__iter__", (PyCFunction)assoc_iter, METH_NOARGS);
+// setting __iter__ resets the slot to the generic slot_tp_iter, so assign it last
+    pytype->tp_iter = (getiterfunc)assoc_iter;
+}
+
 //- generic iterator support over a sequence with operator[] and size ---------
 //-----------------------------------------------------------------------------
 static PyObject* index_iter(PyObject* c) {
@@ -1651,6 +2154,9 @@ bool CPyCppyy::Pythonize(PyObject* pyclass, Cppyy::TCppScope_t scope)
         Utility::AddToClass(pyclass, "__contains__", "contains");
     }
 
+// the generic begin()/end() iteration, if installed, may be replaced by a compiled one
+// below (tp_iter can not tell, as adding __iter__ resets it to the generic slot_tp_iter)
+    bool hasSTLSequenceIter = false;
     if (!IsTemplatedSTLClass(name, "vector")  &&      // vector is dealt with below
            !((PyTypeObject*)pyclass)->tp_iter) {
         if (HasAttrDirect(pyclass, PyStrings::gBegin) && HasAttrDirect(pyclass, PyStrings::gEnd)) {
@@ -1672,6 +2178,7 @@ bool CPyCppyy::Pythonize(PyObject* pyclass, Cppyy::TCppScope_t scope)
                 // install iterator protocol a la STL
                     ((PyTypeObject*)pyclass)->tp_iter = (getiterfunc)STLSequenceIter;
                     Utility::AddToClass(pyclass, "__iter__", (PyCFunction)STLSequenceIter, METH_NOARGS);
+                    hasSTLSequenceIter = true;
                 } else {
                 // still okay if this is some pointer type of builtin persuasion (general class
                 // won't work: the return type needs to understand the iterator protocol)
@@ -1870,6 +2377,10 @@ bool CPyCppyy::Pythonize(PyObject* pyclass, Cppyy::TCppScope_t scope)
                 PyObject_SetAttr(pyclass, PyStrings::gValueSize, pyvalue_size);
                 Py_DECREF(pyvalue_size);
             }
+
+        // direct element access (after __getitem__ is final, as setting it resets the slots)
+            if (HasAttrDirect(pyclass, PyStrings::gLen))
+                InstallVectorAccess(pyclass, vtype, typesz);
         }
     }
 
@@ -1889,6 +2400,10 @@ bool CPyCppyy::Pythonize(PyObject* pyclass, Cppyy::TCppScope_t scope)
     // none was reflected (still O(log n)/O(1), never iterating).
         if (!HasAttrDirect(pyclass, PyStrings::gContains))
             Utility::AddToClass(pyclass, "__contains__", (PyCFunction)STLContainsWithFind, METH_O);
+
+    // single compiled call per iteration step
+        if (hasSTLSequenceIter)
+            InstallAssocIter(pyclass, scope, true /* isMap */);
     }
 
     else if (IsTemplatedSTLClass(name, "set")) {
@@ -1901,6 +2416,16 @@ bool CPyCppyy::Pythonize(PyObject* pyclass, Cppyy::TCppScope_t scope)
     // none was reflected (still O(log n), never iterating).
         if (!HasAttrDirect(pyclass, PyStrings::gContains))
             Utility::AddToClass(pyclass, "__contains__", (PyCFunction)STLContainsWithFind, METH_O);
+
+    // single compiled call per iteration step
+        if (hasSTLSequenceIter)
+            InstallAssocIter(pyclass, scope, false /* isMap */);
+    }
+
+    else if (IsTemplatedSTLClass(name, "unordered_set")) {
+    // single compiled call per iteration step, as for std::set
+        if (hasSTLSequenceIter)
+            InstallAssocIter(pyclass, scope, false /* isMap */);
     }
 
     else if (IsTemplatedSTLClass(name, "pair")) {
@@ -2041,3 +2566,13 @@ bool CPyCppyy::Pythonize(PyObject* pyclass, Cppyy::TCppScope_t scope)
 // phew! all done ...
     return pstatus;
 }
+
+//-----------------------------------------------------------------------------
+bool CPyCppyy::SetMapIterTuplePolicy(bool tuples)
+{
+// Select whether iterating a std::map type container yields (key, value) tuples of
+// converted builtins instead of std::pair proxies. Returns the previous setting.
+    bool old = (bool)sMapIterTuples;
+    sMapIterTuples = tuples ? 1 : 0;
+    return old;
+}
@@ -10,6 +10,9 @@ namespace CPyCppyy {
 // make the named C++ class more python-like
 bool Pythonize(PyObject* pyclass, Cppyy::TCppScope_t scope);
 
+// iterate std::map type containers as (key, value) tuples rather than std::pair proxies
+bool SetMapIterTuplePolicy(bool tuples);
+
 } // namespace CPyCppyy
 
 #endif // !CPYCPPYY_PYTHONIZE_H
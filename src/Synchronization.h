@@ -0,0 +1,162 @@
+#ifndef CPYCPPYY_SYNCHRONIZATION_H
+#define CPYCPPYY_SYNCHRONIZATION_H
+
+// Process-wide state that is shared between threads relies on the GIL for its
+// consistency. On free-threaded builds (Py_GIL_DISABLED), the helpers below provide
+// the necessary locking; elsewhere, they compile away.
+
+// Standard
+#include <stdint.h>
+#include <mutex>
+#include <utility>
+#include <vector>
+#ifdef Py_GIL_DISABLED
+#include <atomic>
+#endif
+
+
+namespace CPyCppyy {
+
+#ifdef Py_GIL_DISABLED
+// PyMutex detaches the thread state while blocked, so holding one can not deadlock
+// against a stop-the-world pause of the interpreter; not re-entrant
+class Mutex {
+public:
+    Mutex() : fMutex{} {}
+    Mutex(const Mutex&) = delete;
+    Mutex& operator=(const Mutex&) = delete;
+
+    void lock()   { PyMutex_Lock(&fMutex); }
+    void unlock() { PyMutex_Unlock(&fMutex); }
+
+private:
+    PyMutex fMutex;
+};
+
+// reference counts and flag words that are updated in place
+typedef std::atomic<int>      SharedCount_t;
+typedef std::atomic<uint32_t> SharedFlags_t;
+
+// per-thread (rather than shared) free lists of recycled objects
+#define CPYCPPYY_FREELIST_LOCAL thread_local
+
+#else
+class Mutex {
+public:
+    void lock()   {}
+    void unlock() {}
+};
+
+typedef int      SharedCount_t;
+typedef uint32_t SharedFlags_t;
+
+#define CPYCPPYY_FREELIST_LOCAL
+#endif
+
+typedef std::lock_guard<Mutex> LockGuard;
+
+// one out of a fixed set of locks, selected by address, for objects that are too
+// numerous, or not owned closely enough, to carry a lock of their own
+inline Mutex& StripedLock(const void* addr)
+{
+    static Mutex locks[64];
+    uintptr_t a = (uintptr_t)addr;
+    return locks[(a ^ (a >> 6) ^ (a >> 12)) & 63];
+}
+
+// pointers to lazily created objects that, once set, are not replaced until destruction;
+// create() runs at most once per pointer and must not itself use CreateOnce()
+#ifdef Py_GIL_DISABLED
+template<typename T>
+inline T* LoadOnce(T* const& p) { return (T*)_Py_atomic_load_ptr_acquire(&p); }
+
+template<typename T, typename F>
+inline T* CreateOnce(T*& p, F create)
+{
+    T* v = LoadOnce(p);
+    if (v) return v;
+
+    LockGuard lock(StripedLock(&p));
+    v = (T*)_Py_atomic_load_ptr_relaxed(&p);
+    if (!v) {
+        v = create();
+        _Py_atomic_store_ptr_release(&p, v);
+    }
+    return v;
+}
+#else
+template<typename T>
+inline T* LoadOnce(T* const& p) { return p; }
+
+template<typename T, typename F>
+inline T* CreateOnce(T*& p, F create)
+{
+    if (!p) p = create();
+    return p;
+}
+#endif
+
+// int fields that double as the flag for initialization of other data: the field is
+// stored last, with release semantics, so that a reader acquiring it sees that data
+#ifdef Py_GIL_DISABLED
+inline int LoadAcquire(const int& i) { return _Py_atomic_load_int_acquire(&i); }
+inline void StoreRelease(int& i, int v) { _Py_atomic_store_int_release(&i, v); }
+#else
+inline int LoadAcquire(const int& i) { return i; }
+inline void StoreRelease(int& i, int v) { i = v; }
+#endif
+
+/** Read-copy-update table: lock-free readers, and writers that serialize among each
+    other and publish a modified copy. Replaced copies are retired rather than freed,
+    as a reader may still be using them; use only for tables with rare updates.
+ */
+
+template<typename T>
+class RCUTable {
+public:
+    RCUTable(const RCUTable&) = delete;
+    RCUTable& operator=(const RCUTable&) = delete;
+
+#ifdef Py_GIL_DISABLED
+    RCUTable() : fCurrent(new T) {}
+
+// current version of the table; remains valid for the lifetime of the process
+    const T& Read() const { return *fCurrent.load(std::memory_order_acquire); }
+
+// apply f(T&) to a copy of the table, then publish that copy; returns f's result
+    template<typename F>
+    auto Update(F f) -> decltype(f(std::declval<T&>())) {
+        LockGuard lock(fMutex);
+        T* old = fCurrent.load(std::memory_order_relaxed);
+        T* copy = new T(*old);
+        auto result = f(*copy);
+        fCurrent.store(copy, std::memory_order_release);
+        fRetired.push_back(old);
+        return result;
+    }
+
+// the table itself, for filling during static initialization only
+    T& Unsynchronized() { return *fCurrent.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<T*> fCurrent;
+    Mutex fMutex;
+    std::vector<T*> fRetired;
+#else
+    RCUTable() {}
+
+    const T& Read() const { return fTable; }
+
+    template<typename F>
+    auto Update(F f) -> decltype(f(std::declval<T&>())) { return f(fTable); }
+
+    T& Unsynchronized() { return fTable; }
+
+private:
+    T fTable;
+#endif
+};
+
+} // namespace CPyCppyy
+
+#endif // !CPYCPPYY_SYNCHRONIZATION_H
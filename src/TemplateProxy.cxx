@@ -40,11 +40,7 @@ TemplateInfo::~TemplateInfo()
     Py_DECREF(fTemplated);
     Py_DECREF(fLowPriority);
 
-    for (const auto& p : fDispatchMap) {
-        for (const auto& c : p.second) {
-            Py_DECREF(c.second);
-        }
-    }
+// memoized overloads are released by the dispatch map itself
 }
 
 
@@ -438,18 +434,11 @@ static inline void UpdateDispatchMap(TemplateProxy* pytmpl, bool use_targs, uint
 {
 // Memoize a method in the dispatch map after successful call; replace old if need be (may be
 // with the same CPPOverload, just with more methods).
-    bool bInserted = false;
-    auto& v = pytmpl->fTI->fDispatchMap[use_targs ? targs2str(pytmpl) : ""];
+    std::string key = use_targs ? targs2str(pytmpl) : "";
 
     Py_INCREF(pymeth);
-    for (auto& p : v) {
-        if (p.first == sighash) {
-            Py_DECREF(p.second);
-            p.second = pymeth;
-            bInserted = true;
-        }
-    }
-    if (!bInserted) v.push_back(std::make_pair(sighash, pymeth));
+    LockGuard lock(pytmpl->fTI->fDispatchMutex);
+    pytmpl->fTI->fDispatchMap[key].Insert(sighash, pymeth);
 }
 
 static inline PyObject* SelectAndForward(TemplateProxy* pytmpl, CPPOverload* pymeth,
@@ -546,13 +535,12 @@ static PyObject* tpp_vectorcall(
 
     CPPOverload* ol = nullptr;
     if (!pytmpl->fTemplateArgs) {
-    // look for known signatures ...
-        auto& v = pytmpl->fTI->fDispatchMap[""];
-        for (const auto& p : v) {
-            if (p.first == sighash) {
-                ol = p.second;
-                break;
-            }
+    // look for known signatures; the map may evict (and release) ol during a re-entrant
+    // call, or concurrently, so take a reference while still holding the lock
+        {
+            LockGuard lock(pytmpl->fTI->fDispatchMutex);
+            ol = pytmpl->fTI->fDispatchMap[""].Find(sighash);
+            Py_XINCREF((PyObject*)ol);
         }
 
         if (ol != nullptr) {
@@ -564,6 +552,7 @@ static PyObject* tpp_vectorcall(
                 result = CPyCppyy_tp_call(pymeth, args, nargsf, kwds);
                 Py_DECREF(pymeth); pymeth = nullptr;
             }
+            Py_DECREF((PyObject*)ol);
             if (result)
                 return result;
         }
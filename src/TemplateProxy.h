@@ -3,6 +3,8 @@
 
 // Bindings
 #include "CPPScope.h"
+#include "DispatchMap.h"
+#include "Synchronization.h"
 #include "Utility.h"
 
 // Standard
@@ -21,8 +23,13 @@ class CPPOverload;
 /** Template proxy object to return functions and methods
  */
 
-typedef std::pair<uint64_t, CPPOverload*> TP_DispatchEntry_t;
-typedef std::unordered_map<std::string, std::vector<TP_DispatchEntry_t>> TP_DispatchMap_t;
+// memoized overloads are owned by the dispatch map
+struct TP_DispatchRelease {
+    void operator()(CPPOverload* ol) const { Py_DECREF((PyObject*)ol); }
+};
+
+typedef DispatchMap<CPPOverload*, TP_DispatchRelease> TP_DispatchEntries_t;
+typedef std::unordered_map<std::string, TP_DispatchEntries_t> TP_DispatchMap_t;
 
 class TemplateInfo {
 public:
@@ -39,6 +46,7 @@ public:
     CPPOverload* fLowPriority;    // low priority overloads such as void*/void**
 
     TP_DispatchMap_t fDispatchMap;
+    Mutex fDispatchMutex;         // guards fDispatchMap on free-threaded builds
     PyObject* fDoc;
 };
 
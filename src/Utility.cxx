@@ -8,6 +8,7 @@
 #include "ProxyWrappers.h"
 #include "PyCallable.h"
 #include "PyStrings.h"
+#include "Synchronization.h"
 #include "CustomPyTypes.h"
 #include "TemplateProxy.h"
 #include "TypeManip.h"
@@ -1468,6 +1469,43 @@ void CPyCppyy::Utility::SetDetailedException(std::vector<PyError_t>&& errors, Py
 }
 
 
+//----------------------------------------------------------------------------
+bool CPyCppyy::Utility::IsTriviallyCopyable(Cppyy::TCppScope_t klass)
+{
+// there is no backend query for this, so the compiler is asked (once per class)
+    static std::unordered_map<Cppyy::TCppScope_t, bool> sTrivial;
+    static Mutex sTrivialMutex;
+    static int count = 0;
+
+    std::ostringstream fname;
+    {
+        LockGuard lock(sTrivialMutex);
+        auto t = sTrivial.find(klass);
+        if (t != sTrivial.end())
+            return t->second;
+        fname << "is_trivially_copyable" << ++count;
+    }
+
+    std::ostringstream code;
+    code << "#include <type_traits>\n"
+         << "namespace __cppyy_internal { bool " << fname.str() << "() { return "
+         << "std::is_trivially_copyable<" << Cppyy::GetScopedFinalName(klass) << ">::value; } }";
+
+    bool trivial = false;
+    if (Cppyy::Compile(code.str(), true /* silent */)) {
+        Cppyy::TCppScope_t cis = Cppyy::GetScope("__cppyy_internal");
+        const auto& methods = Cppyy::GetMethodsFromName(cis, fname.str());
+        if (!methods.empty()) {
+            Cppyy::TCppFuncAddr_t faddr = Cppyy::GetFunctionAddress(methods[0], false);
+            if (faddr) trivial = ((bool(*)())faddr)();
+        }
+    }
+
+    LockGuard lock(sTrivialMutex);
+    sTrivial.emplace(klass, trivial);
+    return trivial;
+}
+
 //----------------------------------------------------------------------------
 static bool includesDone = false;
 bool CPyCppyy::Utility::IncludePython()
@@ -97,6 +97,9 @@ struct PyOperators {
 std::string ClassName(PyObject* pyobj);
 bool IsSTLIterator(const std::string& classname);
 
+// whether objects of the given class can be copied byte-wise (cached per class)
+bool IsTriviallyCopyable(Cppyy::TCppScope_t klass);
+
 // for threading: save call to PyErr_Occurred()
 PyObject* PyErr_Occurred_WithGIL();
 